@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/time_utils.hpp"
 #include "ohlc_bar.hpp"
 #include "robin_hood.h"
 #include <cstdint>
@@ -20,6 +21,15 @@ public:
    */
   bool update(int32_t id, double price, int64_t timestamp_ms);
 
+  /**
+   * @brief Update with a ms-since-UTC-midnight timestamp, e.g.
+   * BookTicker::event_time_ms_midnight. The UTC day is tracked internally
+   * (starting from the day of construction) so bars keep rolling across
+   * midnight.
+   * @return true if a new time window started (bars ready to consume)
+   */
+  bool update_intraday(int32_t id, double price, int32_t ms_since_midnight);
+
   /**
    * @brief Access the completed bars (from the previous interval).
    */
@@ -42,6 +52,7 @@ private:
 
   BarMap bars_by_id;
   BarMap completed_bars;
+  UtcMidnightCache day_cache;
 
   int64_t now_ms() const;
   int64_t get_window_start_ms(int64_t timestamp_ms) const;
@@ -8,6 +8,7 @@ inline BarAggregator::BarAggregator(int64_t bar_interval_ms)
   int64_t now = now_ms();
   current_window_start_ms = get_window_start_ms(now);
   current_window_stop_ms = current_window_start_ms + interval_ms;
+  day_cache.set_day(now);
 }
 
 inline bool BarAggregator::update(int32_t id, double price,
@@ -33,6 +34,11 @@ inline bool BarAggregator::update(int32_t id, double price,
   return rollover_occurred;
 }
 
+inline bool BarAggregator::update_intraday(int32_t id, double price,
+                                           int32_t ms_since_midnight) {
+  return update(id, price, day_cache.to_epoch_ms(ms_since_midnight));
+}
+
 inline const BarAggregator::BarMap &
 BarAggregator::consume_completed_bars() const {
   return completed_bars;
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "ohlc_bar.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// Which price of the top of book a bar aggregates (see compute_prices).
+enum class BarPriceSource : uint8_t {
+  Mid,     ///< (bid + ask) / 2
+  Micro,   ///< Qty-weighted toward the thinner side
+  Weighted ///< Qty-weighted toward the thicker side
+};
+
+/**
+ * @struct BarMessage
+ * @brief Completed OHLC bar as published by binance_main's bars stage
+ * (`--bars`), one per symbol and horizon.
+ *
+ * Sent as the payload of a [topic | payload] ZMQ message on the bars socket;
+ * the topic is book_ticker_topic(id), so consumers subscribe per symbol the
+ * same way as for tickers. Trivially copyable, 64 bytes.
+ */
+struct BarMessage {
+  int64_t start_time_ms; ///< Window start, event time (epoch ms)
+  int64_t end_time_ms;   ///< Window end (exclusive)
+  double open;
+  double high;
+  double low;
+  double close;
+  uint32_t count;      ///< Tickers aggregated
+  int32_t interval_ms; ///< Bar length (horizon)
+  int16_t id;          ///< Global symbol ID
+  uint16_t slot;       ///< Producer's dense symbol slot
+  BarPriceSource price_source;
+  uint8_t reserved[3];
+};
+
+static_assert(sizeof(BarMessage) == 64, "BarMessage must be 64 bytes");
+static_assert(std::is_trivially_copyable<BarMessage>::value,
+              "BarMessage must be trivially copyable");
+
+/// The BarMessage of a completed @p bar of symbol @p id / @p slot.
+inline BarMessage make_bar_message(const OHLCBar &bar, int32_t id,
+                                   size_t slot, int32_t interval_ms,
+                                   BarPriceSource price_source) {
+  BarMessage msg{};
+  msg.start_time_ms = bar.start_time_ms;
+  msg.end_time_ms = bar.end_time_ms;
+  msg.open = bar.open;
+  msg.high = bar.high;
+  msg.low = bar.low;
+  msg.close = bar.close;
+  msg.count = static_cast<uint32_t>(bar.count);
+  msg.interval_ms = interval_ms;
+  msg.id = static_cast<int16_t>(id);
+  msg.slot = static_cast<uint16_t>(slot);
+  msg.price_source = price_source;
+  return msg;
+}
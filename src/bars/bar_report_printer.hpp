@@ -5,12 +5,21 @@
 #include "symbol_id_map.hpp"
 #include <algorithm>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
 
+/**
+ * @brief Prints a BarAggregator's completed bars as an aligned report.
+ *
+ * Symbols are sorted by name once, in the constructor, and rows are
+ * formatted into a reused buffer, so a report does not sort or allocate in
+ * steady state. For slot-indexed aggregators see TextBarSink.
+ */
 class BarReportPrinter {
 public:
   BarReportPrinter(const SymbolIdMap &symbol_map)
-      : id_to_symbol_(invert_map(symbol_map)) {}
+      : symbols_by_name_(sorted_by_name(symbol_map)) {}
   /**
    * @brief Print the OHLC report from a BarAggregator, sorted by symbol name.
    *
@@ -22,33 +31,31 @@ public:
     if (bars.empty())
       return;
 
-    std::vector<std::pair<std::string, const OHLCBar *>> rows;
-
-    for (const auto &[id, bar] : bars) {
-      auto it = id_to_symbol_.find(id);
-      if (it != id_to_symbol_.end()) {
-        rows.emplace_back(it->second, &bar);
-      }
-    }
-
-    std::sort(rows.begin(), rows.end(),
-              [](const auto &a, const auto &b) { return a.first < b.first; });
-
-    os << format_ohlc_header() << '\n';
-    for (const auto &[symbol, bar_ptr] : rows) {
-      os << format_ohlc_row(symbol, *bar_ptr) << '\n';
+    buffer_.clear();
+    append_ohlc_header(buffer_);
+    buffer_ += '\n';
+    for (const auto &[id, symbol] : symbols_by_name_) {
+      auto it = bars.find(id);
+      if (it == bars.end())
+        continue;
+      append_ohlc_row(buffer_, symbol, it->second);
+      buffer_ += '\n';
     }
+    os.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
   }
 
 private:
-  using reverse_map = robin_hood::unordered_flat_map<int32_t, std::string>;
-  reverse_map id_to_symbol_;
-
-  static reverse_map invert_map(const SymbolIdMap &symbol_map) {
-    reverse_map reversed;
-    for (const auto &[sym, id] : symbol_map) {
-      reversed[id] = sym;
-    }
-    return reversed;
+  std::vector<std::pair<int32_t, std::string>> symbols_by_name_;
+  mutable std::string buffer_; ///< Report text, reused across calls
+
+  static std::vector<std::pair<int32_t, std::string>>
+  sorted_by_name(const SymbolIdMap &symbol_map) {
+    std::vector<std::pair<int32_t, std::string>> out;
+    for (const auto &[sym, id] : symbol_map)
+      out.emplace_back(id, sym);
+    std::sort(out.begin(), out.end(), [](const auto &a, const auto &b) {
+      return a.second < b.second;
+    });
+    return out;
   }
 };
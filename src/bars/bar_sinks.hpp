@@ -0,0 +1,171 @@
+#pragma once
+
+#include "bar_message.hpp"
+#include "ohlc_bar.hpp"
+#include "ohlc_report.hpp"
+#include "symbol_id_map.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * @file bar_sinks.hpp
+ * @brief Outputs for completed slot-indexed bars (SlotBarAggregator,
+ * MultiHorizonBarAggregator): aligned text, CSV and a fixed-width binary
+ * record file.
+ *
+ * Symbol names and their alphabetical order are resolved once at
+ * construction, and each sink formats a window into a reusable buffer and
+ * hands it to the stream in one write, so steady-state output does not
+ * allocate or sort.
+ */
+
+/// Slots ordered by symbol name.
+inline std::vector<uint16_t>
+slots_by_name(const std::vector<std::string> &slot_names) {
+  std::vector<uint16_t> order(slot_names.size());
+  std::iota(order.begin(), order.end(), uint16_t{0});
+  std::sort(order.begin(), order.end(), [&](uint16_t a, uint16_t b) {
+    return slot_names[a] < slot_names[b];
+  });
+  return order;
+}
+
+/**
+ * @class BarSink
+ * @brief Receives the completed bars of one window, indexed by slot; slots
+ * without ticks (`count == 0`) are skipped.
+ */
+class BarSink {
+public:
+  virtual ~BarSink() = default;
+  virtual void write(std::span<const OHLCBar> bars) = 0;
+};
+
+/// The aligned report of BarReportPrinter: header, then one row per symbol
+/// sorted by name.
+class TextBarSink : public BarSink {
+public:
+  TextBarSink(std::ostream &os, const SymbolSlotMap &symbol_slots)
+      : os_(os), names_(symbol_slot_names(symbol_slots)),
+        order_(slots_by_name(names_)) {}
+
+  void write(std::span<const OHLCBar> bars) override {
+    buffer_.clear();
+    append_ohlc_header(buffer_);
+    buffer_ += '\n';
+    const size_t header = buffer_.size();
+    for (uint16_t slot : order_) {
+      if (slot >= bars.size() || !bars[slot].count)
+        continue;
+      append_ohlc_row(buffer_, names_[slot], bars[slot]);
+      buffer_ += '\n';
+    }
+    if (buffer_.size() > header)
+      os_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  }
+
+private:
+  std::ostream &os_;
+  std::vector<std::string> names_;
+  std::vector<uint16_t> order_;
+  std::string buffer_;
+};
+
+/**
+ * @brief `symbol,start_time_ms,end_time_ms,open,high,low,close,count` rows,
+ * sorted by symbol within a window. Prices use the shortest text that
+ * round-trips, so the file reads back to the exact doubles.
+ */
+class CsvBarSink : public BarSink {
+public:
+  CsvBarSink(std::ostream &os, const SymbolSlotMap &symbol_slots)
+      : os_(os), names_(symbol_slot_names(symbol_slots)),
+        order_(slots_by_name(names_)) {}
+
+  void write(std::span<const OHLCBar> bars) override {
+    buffer_.clear();
+    if (!header_written_) {
+      buffer_ += "symbol,start_time_ms,end_time_ms,open,high,low,close,count\n";
+      header_written_ = true;
+    }
+    for (uint16_t slot : order_) {
+      if (slot >= bars.size() || !bars[slot].count)
+        continue;
+      const OHLCBar &bar = bars[slot];
+      buffer_ += names_[slot];
+      append_field(bar.start_time_ms);
+      append_field(bar.end_time_ms);
+      append_field(bar.open);
+      append_field(bar.high);
+      append_field(bar.low);
+      append_field(bar.close);
+      append_field(bar.count);
+      buffer_ += '\n';
+    }
+    if (!buffer_.empty())
+      os_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+  }
+
+private:
+  std::ostream &os_;
+  std::vector<std::string> names_;
+  std::vector<uint16_t> order_;
+  std::string buffer_;
+  bool header_written_ = false;
+
+  template <typename T> void append_field(T value) {
+    char buf[32];
+    auto res = std::to_chars(buf, buf + sizeof(buf), value);
+    buffer_ += ',';
+    buffer_.append(buf, res.ptr);
+  }
+};
+
+/**
+ * @brief Fixed-width binary records: one 64-byte BarMessage per bar, in
+ * slot order, so a file is an array of BarMessage that can be mmapped or
+ * read back with one read per window.
+ */
+class BinaryBarSink : public BarSink {
+public:
+  /**
+   * @param interval_ms Bar length stored in every record.
+   * @param price_source Price the bars aggregate, stored in every record.
+   */
+  BinaryBarSink(std::ostream &os, const SymbolSlotMap &symbol_slots,
+                int32_t interval_ms,
+                BarPriceSource price_source = BarPriceSource::Mid)
+      : os_(os), slot_ids_(symbol_slot_count(symbol_slots), -1),
+        interval_ms_(interval_ms), price_source_(price_source) {
+    for (const auto &[symbol, ref] : symbol_slots)
+      slot_ids_[ref.slot] = ref.id;
+    records_.reserve(slot_ids_.size());
+  }
+
+  void write(std::span<const OHLCBar> bars) override {
+    records_.clear();
+    for (size_t slot = 0; slot < bars.size() && slot < slot_ids_.size();
+         ++slot) {
+      if (bars[slot].count)
+        records_.push_back(make_bar_message(bars[slot], slot_ids_[slot], slot,
+                                            interval_ms_, price_source_));
+    }
+    if (!records_.empty())
+      os_.write(reinterpret_cast<const char *>(records_.data()),
+                static_cast<std::streamsize>(records_.size() *
+                                             sizeof(BarMessage)));
+  }
+
+private:
+  std::ostream &os_;
+  std::vector<int32_t> slot_ids_; ///< slot → global symbol ID
+  int32_t interval_ms_;
+  BarPriceSource price_source_;
+  std::vector<BarMessage> records_;
+};
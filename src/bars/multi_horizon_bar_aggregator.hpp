@@ -0,0 +1,97 @@
+#pragma once
+
+#include "common/time_utils.hpp"
+#include "ohlc_bar.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Aggregates OHLC bars by symbol slot on several nested horizons
+ * (by default 1s, 1m, 5m and 1h) in one pass.
+ *
+ * Only the finest horizon is updated per tick. When its window closes the
+ * completed bars are merged into the next horizon's current bars, which in
+ * turn roll into the next one when their own window closes, so per-tick work
+ * does not grow with the number of horizons. Each horizon is double-buffered
+ * like SlotBarAggregator and exposes the same consume / clear interface,
+ * indexed by horizon.
+ *
+ * Windows follow event time only: the first tick opens them, and nothing
+ * reads the wall clock, so replaying a recording produces the same bars as
+ * the live run did. As in BarAggregator, a late tick (event time before the
+ * current window, e.g. a symbol whose "E" lags another's by a millisecond)
+ * counts toward the current window; completed bars are never reopened.
+ */
+class MultiHorizonBarAggregator {
+public:
+  /**
+   * @param slots Number of symbol slots (see symbol_slot_count).
+   * @param horizons_ms Bar lengths, ascending, each a multiple of the
+   * previous one.
+   * @throws std::invalid_argument if @p horizons_ms is empty or not nested.
+   */
+  explicit MultiHorizonBarAggregator(
+      size_t slots,
+      std::vector<int64_t> horizons_ms = {1'000, 60'000, 300'000, 3'600'000});
+
+  /**
+   * @brief Update the finest bar of @p slot with an event-time price
+   * (exchange "E" in epoch ms). Slots out of range are ignored.
+   * @return true if the finest window rolled over (coarser horizons may
+   * have completed too; check has_completed_bars()).
+   */
+  bool update(uint16_t slot, double price, int64_t event_time_ms);
+
+  /**
+   * @brief Update with a ms-since-UTC-midnight event time, e.g.
+   * BookTicker::event_time_ms_midnight, placed on the day given to
+   * set_day() and rolling across midnight from there.
+   */
+  bool update_intraday(uint16_t slot, double price, int32_t ms_since_midnight);
+
+  /// Anchors update_intraday() to the UTC day of @p event_time_ms.
+  void set_day(int64_t event_time_ms);
+
+  /// Number of horizons.
+  size_t horizons() const { return horizons_.size(); }
+
+  /// Bar length of horizon @p h.
+  int64_t interval_ms(size_t h) const { return horizons_[h].interval_ms; }
+
+  /**
+   * @brief Access the completed bars of horizon @p h (its previous window),
+   * indexed by slot; empty after clear_completed(h).
+   */
+  std::span<const OHLCBar> consume_completed_bars(size_t h) const;
+
+  /**
+   * @brief Clears the completed bars of horizon @p h after consumption.
+   */
+  void clear_completed(size_t h);
+
+  /**
+   * @brief Returns true if horizon @p h has bars from its last window.
+   */
+  bool has_completed_bars(size_t h) const;
+
+private:
+  struct Horizon {
+    int64_t interval_ms = 0;
+    int64_t window_start_ms = 0;
+    int64_t window_stop_ms = 0;
+    std::array<std::vector<OHLCBar>, 2> buffers; ///< current / completed
+    size_t current = 0;           ///< Index of the buffer collecting bars
+    bool current_touched = false; ///< Current window has seen a tick
+    bool completed_ready = false; ///< buffers[current ^ 1] holds a window
+  };
+
+  std::vector<Horizon> horizons_; ///< finest first
+  bool started_ = false;          ///< Windows opened by the first tick
+  UtcMidnightCache day_cache;
+
+  static void open_window(Horizon &horizon, int64_t event_time_ms);
+  void roll(size_t h, int64_t event_time_ms);
+};
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "multi_horizon_bar_aggregator.hpp"
+#include <stdexcept>
+#include <string>
+
+inline MultiHorizonBarAggregator::MultiHorizonBarAggregator(
+    size_t slots, std::vector<int64_t> horizons_ms) {
+  if (horizons_ms.empty())
+    throw std::invalid_argument("❌ No bar horizons given");
+  for (size_t h = 0; h < horizons_ms.size(); ++h) {
+    int64_t interval = horizons_ms[h];
+    if (interval <= 0 ||
+        (h > 0 && (interval <= horizons_ms[h - 1] ||
+                   interval % horizons_ms[h - 1] != 0)))
+      throw std::invalid_argument("❌ Bar horizon " + std::to_string(interval) +
+                                  " ms is not a multiple of the previous one");
+    Horizon horizon;
+    horizon.interval_ms = interval;
+    horizon.buffers = {std::vector<OHLCBar>(slots),
+                       std::vector<OHLCBar>(slots)};
+    horizons_.push_back(std::move(horizon));
+  }
+}
+
+inline bool MultiHorizonBarAggregator::update(uint16_t slot, double price,
+                                              int64_t event_time_ms) {
+  if (!started_) [[unlikely]] {
+    for (Horizon &horizon : horizons_)
+      open_window(horizon, event_time_ms);
+    started_ = true;
+  }
+
+  Horizon &fine = horizons_.front();
+  bool rollover_occurred = false;
+  if (event_time_ms >= fine.window_stop_ms) {
+    roll(0, event_time_ms);
+    rollover_occurred = true;
+  }
+
+  std::vector<OHLCBar> &bars = fine.buffers[fine.current];
+  if (slot >= bars.size())
+    return rollover_occurred;
+  OHLCBar &bar = bars[slot];
+  fine.current_touched = true;
+  bar.update(price, event_time_ms);
+  bar.start_time_ms = fine.window_start_ms;
+  bar.end_time_ms = fine.window_stop_ms;
+
+  return rollover_occurred;
+}
+
+inline bool MultiHorizonBarAggregator::update_intraday(
+    uint16_t slot, double price, int32_t ms_since_midnight) {
+  return update(slot, price, day_cache.to_epoch_ms(ms_since_midnight));
+}
+
+inline void MultiHorizonBarAggregator::set_day(int64_t event_time_ms) {
+  day_cache.set_day(event_time_ms);
+}
+
+inline std::span<const OHLCBar>
+MultiHorizonBarAggregator::consume_completed_bars(size_t h) const {
+  const Horizon &horizon = horizons_[h];
+  if (!horizon.completed_ready)
+    return {};
+  return horizon.buffers[horizon.current ^ 1];
+}
+
+inline void MultiHorizonBarAggregator::clear_completed(size_t h) {
+  horizons_[h].completed_ready = false;
+}
+
+inline bool MultiHorizonBarAggregator::has_completed_bars(size_t h) const {
+  return horizons_[h].completed_ready;
+}
+
+/// Opens the window of @p horizon containing @p event_time_ms.
+inline void MultiHorizonBarAggregator::open_window(Horizon &horizon,
+                                                   int64_t event_time_ms) {
+  int64_t start = event_time_ms / horizon.interval_ms * horizon.interval_ms;
+  if (start > event_time_ms) // negative (pre-epoch) times round down
+    start -= horizon.interval_ms;
+  horizon.window_start_ms = start;
+  horizon.window_stop_ms = start + horizon.interval_ms;
+}
+
+/**
+ * Completes the current window of horizon @p h, merges it into the window of
+ * the next horizon that contains it, rolls that one too if @p event_time_ms
+ * is past its end, and opens the window of @p h containing @p event_time_ms.
+ * Nesting keeps the finished window inside the next horizon's current one.
+ */
+inline void MultiHorizonBarAggregator::roll(size_t h, int64_t event_time_ms) {
+  Horizon &horizon = horizons_[h];
+  horizon.current ^= 1;
+  for (OHLCBar &bar : horizon.buffers[horizon.current])
+    bar.reset();
+  horizon.completed_ready = horizon.current_touched;
+  horizon.current_touched = false;
+
+  if (h + 1 < horizons_.size()) {
+    Horizon &up = horizons_[h + 1];
+    if (horizon.completed_ready) {
+      const std::vector<OHLCBar> &done = horizon.buffers[horizon.current ^ 1];
+      std::vector<OHLCBar> &into = up.buffers[up.current];
+      for (size_t slot = 0; slot < done.size(); ++slot) {
+        if (!done[slot].count)
+          continue;
+        into[slot].merge(done[slot]);
+        into[slot].start_time_ms = up.window_start_ms;
+        into[slot].end_time_ms = up.window_stop_ms;
+      }
+      up.current_touched = true;
+    }
+    if (event_time_ms >= up.window_stop_ms)
+      roll(h + 1, event_time_ms);
+  }
+
+  open_window(horizon, event_time_ms);
+}
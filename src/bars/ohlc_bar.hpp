@@ -1,17 +1,32 @@
 #pragma once
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
-struct OHLCBar {
-  double open = std::numeric_limits<double>::quiet_NaN();
-  double high = std::numeric_limits<double>::lowest();
-  double low = std::numeric_limits<double>::max();
-  double close = std::numeric_limits<double>::quiet_NaN();
+/**
+ * @brief OHLC bar over a price type: `double` for the floating-point
+ * pipeline, `int64_t` ticks for the fixed-point one (see FixedBookTicker and
+ * FixedSlotBarAggregator), where high/low updates become plain integer
+ * compares.
+ */
+template <typename Price> struct BasicOHLCBar {
+  /// Open/close value of a bar that has not seen a tick yet
+  static constexpr Price empty_price() {
+    if constexpr (std::is_floating_point_v<Price>)
+      return std::numeric_limits<Price>::quiet_NaN();
+    else
+      return 0;
+  }
+
+  Price open = empty_price();
+  Price high = std::numeric_limits<Price>::lowest();
+  Price low = std::numeric_limits<Price>::max();
+  Price close = empty_price();
   int64_t start_time_ms = 0;
   int64_t end_time_ms = 0;
   uint64_t count = 0; // Number of ticks aggregated
 
-  void update(double price, int64_t timestamp_ms) {
+  void update(Price price, int64_t timestamp_ms) {
     if (count == 0) {
       open = high = low = close = price;
       start_time_ms = timestamp_ms;
@@ -26,11 +41,34 @@ struct OHLCBar {
     ++count;
   }
 
+  /// Folds a later bar of the same symbol into this one (bar roll-up).
+  void merge(const BasicOHLCBar &later) {
+    if (later.count == 0)
+      return;
+    if (count == 0) {
+      open = later.open;
+      high = later.high;
+      low = later.low;
+      start_time_ms = later.start_time_ms;
+    } else {
+      if (later.high > high)
+        high = later.high;
+      if (later.low < low)
+        low = later.low;
+    }
+    close = later.close;
+    end_time_ms = later.end_time_ms;
+    count += later.count;
+  }
+
   void reset() {
-    open = close = std::numeric_limits<double>::quiet_NaN();
-    high = std::numeric_limits<double>::lowest();
-    low = std::numeric_limits<double>::max();
+    open = close = empty_price();
+    high = std::numeric_limits<Price>::lowest();
+    low = std::numeric_limits<Price>::max();
     count = 0;
     start_time_ms = end_time_ms = 0;
   }
 };
+
+using OHLCBar = BasicOHLCBar<double>;
+using FixedOHLCBar = BasicOHLCBar<int64_t>;
@@ -1,9 +1,69 @@
 #pragma once
 
 #include "ohlc_bar.hpp"
-#include <iomanip>
-#include <sstream>
+#include <charconv>
+#include <cstddef>
 #include <string>
+#include <string_view>
+
+/// Column width of the text report.
+inline constexpr size_t kOhlcColumnWidth = 10;
+
+/// Appends @p text left-aligned in a @p width column (never truncated).
+inline void append_left(std::string &out, std::string_view text,
+                        size_t width = kOhlcColumnWidth) {
+  out.append(text);
+  if (text.size() < width)
+    out.append(width - text.size(), ' ');
+}
+
+/// Appends @p text right-aligned in a @p width column (never truncated).
+inline void append_right(std::string &out, std::string_view text,
+                         size_t width = kOhlcColumnWidth) {
+  if (text.size() < width)
+    out.append(width - text.size(), ' ');
+  out.append(text);
+}
+
+/// Appends @p value with 2 decimals, right-aligned; same text as
+/// `std::fixed << std::setprecision(2) << std::setw(width)`.
+inline void append_fixed2(std::string &out, double value,
+                          size_t width = kOhlcColumnWidth) {
+  char buf[352]; // fits any double in fixed notation
+  auto res = std::to_chars(buf, buf + sizeof(buf), value,
+                           std::chars_format::fixed, 2);
+  append_right(out, std::string_view(buf, res.ptr), width);
+}
+
+/// Appends an integer right-aligned in a @p width column.
+template <typename Int>
+inline void append_int(std::string &out, Int value,
+                       size_t width = kOhlcColumnWidth) {
+  char buf[24];
+  auto res = std::to_chars(buf, buf + sizeof(buf), value);
+  append_right(out, std::string_view(buf, res.ptr), width);
+}
+
+/**
+ * @brief Appends one aligned OHLC row (no newline) to @p out; no allocation
+ * once @p out has grown to its working size.
+ */
+inline void append_ohlc_row(std::string &out, std::string_view symbol,
+                            const OHLCBar &bar) {
+  append_left(out, symbol);
+  append_fixed2(out, bar.open);
+  append_fixed2(out, bar.high);
+  append_fixed2(out, bar.low);
+  append_fixed2(out, bar.close);
+  append_int(out, bar.count);
+}
+
+/// Appends the header matching append_ohlc_row (no newline).
+inline void append_ohlc_header(std::string &out) {
+  append_left(out, "Symbol");
+  for (std::string_view label : {"Open", "High", "Low", "Close", "Count"})
+    append_right(out, label);
+}
 
 /**
  * @brief Returns a formatted string representing the OHLC bar for a given
@@ -11,21 +71,16 @@
  */
 inline std::string format_ohlc_row(const std::string &symbol,
                                    const OHLCBar &bar) {
-  std::ostringstream oss;
-  oss << std::left << std::setw(10) << symbol << std::right << std::fixed
-      << std::setprecision(2) << std::setw(10) << bar.open << std::setw(10)
-      << bar.high << std::setw(10) << bar.low << std::setw(10) << bar.close
-      << std::setw(10) << bar.count;
-  return oss.str();
+  std::string out;
+  append_ohlc_row(out, symbol, bar);
+  return out;
 }
 
 /**
  * @brief Returns a header string with aligned column labels.
  */
 inline std::string format_ohlc_header() {
-  std::ostringstream oss;
-  oss << std::left << std::setw(10) << "Symbol" << std::right << std::setw(10)
-      << "Open" << std::setw(10) << "High" << std::setw(10) << "Low"
-      << std::setw(10) << "Close" << std::setw(10) << "Count";
-  return oss.str();
+  std::string out;
+  append_ohlc_header(out);
+  return out;
 }
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "common/price_calc.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @file quote_bar.hpp
+ * @brief Bars over top-of-book quotes whose statistics are chosen at compile
+ * time: QuoteBar<Fields...> inherits one policy per statistic, so a bar
+ * carries only the state and per-tick work of the fields it names.
+ *
+ * A quote is anything with `bid_price`, `bid_qty`, `ask_price` and `ask_qty`
+ * (e.g. BookTicker). Every policy provides:
+ *
+ * - `on_quote(q, ts)`    per tick, O(1)
+ * - `close(end_ms)`      once at the end of the window
+ * - `carry(prev, start)` opening the next window from the previous one
+ * - `reset()`
+ *
+ * Time-weighted fields hold each quote until the next one, so the prevailing
+ * quote is carried into the next window and weighs from its start even
+ * before that window's first tick. A window that only carries a quote
+ * (count == 0) reports the prevailing values: its micro OHLC is flat at the
+ * previous close and its top sizes are the last ones seen.
+ */
+
+/// Time-weighted average of `Value::of(quote)` over the window.
+template <typename Value> struct TimeWeighted {
+  double area = 0.0;        ///< Σ value · ms
+  int64_t weighted_ms = 0;  ///< Σ ms
+  double last = std::numeric_limits<double>::quiet_NaN();
+  int64_t last_ts = 0;
+
+  /// NaN when the window saw no quote.
+  double average() const {
+    return weighted_ms > 0 ? area / static_cast<double>(weighted_ms) : last;
+  }
+
+  template <typename Quote> void on_quote(const Quote &q, int64_t ts) {
+    hold_until(ts);
+    last = Value::of(q);
+    last_ts = std::max(last_ts, ts);
+  }
+
+  void close(int64_t end_ms) { hold_until(end_ms); }
+
+  void carry(const TimeWeighted &prev, int64_t start_ms) {
+    last = prev.last;
+    last_ts = start_ms;
+  }
+
+  void reset() { *this = TimeWeighted{}; }
+
+private:
+  /// Credits the held quote with the time up to @p ts (late ticks add 0).
+  void hold_until(int64_t ts) {
+    if (last != last || ts <= last_ts) // NaN: nothing held yet
+      return;
+    area += last * static_cast<double>(ts - last_ts);
+    weighted_ms += ts - last_ts;
+    last_ts = ts;
+  }
+};
+
+/// Mid price of a quote.
+struct MidValue {
+  template <typename Quote> static double of(const Quote &q) {
+    return 0.5 * (q.bid_price + q.ask_price);
+  }
+};
+
+/// Quoted spread (ask − bid).
+struct SpreadValue {
+  template <typename Quote> static double of(const Quote &q) {
+    return q.ask_price - q.bid_price;
+  }
+};
+
+/// Time-weighted mid price: `twap_mid.average()`.
+struct TwMid {
+  TimeWeighted<MidValue> twap_mid;
+
+  template <typename Quote> void on_quote(const Quote &q, int64_t ts) {
+    twap_mid.on_quote(q, ts);
+  }
+  void close(int64_t end_ms) { twap_mid.close(end_ms); }
+  void carry(const TwMid &prev, int64_t start_ms) {
+    twap_mid.carry(prev.twap_mid, start_ms);
+  }
+  void reset() { twap_mid.reset(); }
+};
+
+/// Time-weighted spread: `tw_spread.average()`.
+struct TwSpread {
+  TimeWeighted<SpreadValue> tw_spread;
+
+  template <typename Quote> void on_quote(const Quote &q, int64_t ts) {
+    tw_spread.on_quote(q, ts);
+  }
+  void close(int64_t end_ms) { tw_spread.close(end_ms); }
+  void carry(const TwSpread &prev, int64_t start_ms) {
+    tw_spread.carry(prev.tw_spread, start_ms);
+  }
+  void reset() { tw_spread.reset(); }
+};
+
+/// Average best bid / ask quantity per tick; without ticks, the prevailing
+/// (last seen) sizes, NaN if none.
+struct AvgTopSize {
+  double bid_qty_sum = 0.0;
+  double ask_qty_sum = 0.0;
+  uint64_t size_ticks = 0;
+  double last_bid_qty = std::numeric_limits<double>::quiet_NaN();
+  double last_ask_qty = std::numeric_limits<double>::quiet_NaN();
+
+  double avg_bid_qty() const {
+    return size_ticks ? bid_qty_sum / static_cast<double>(size_ticks)
+                      : last_bid_qty;
+  }
+  double avg_ask_qty() const {
+    return size_ticks ? ask_qty_sum / static_cast<double>(size_ticks)
+                      : last_ask_qty;
+  }
+
+  template <typename Quote> void on_quote(const Quote &q, int64_t) {
+    bid_qty_sum += q.bid_qty;
+    ask_qty_sum += q.ask_qty;
+    ++size_ticks;
+    last_bid_qty = q.bid_qty;
+    last_ask_qty = q.ask_qty;
+  }
+  void close(int64_t) {}
+  void carry(const AvgTopSize &prev, int64_t) {
+    last_bid_qty = prev.last_bid_qty;
+    last_ask_qty = prev.last_ask_qty;
+  }
+  void reset() { *this = AvgTopSize{}; }
+};
+
+/// OHLC of the micro-price (see compute_prices); quotes with no size skip.
+/// A window without a micro-price is flat at the previous close (NaN if
+/// there is none).
+struct MicroOHLC {
+  double micro_open = std::numeric_limits<double>::quiet_NaN();
+  double micro_high = std::numeric_limits<double>::quiet_NaN();
+  double micro_low = std::numeric_limits<double>::quiet_NaN();
+  double micro_close = std::numeric_limits<double>::quiet_NaN();
+  double carried_close = std::numeric_limits<double>::quiet_NaN();
+
+  template <typename Quote> void on_quote(const Quote &q, int64_t) {
+    double micro =
+        compute_prices(q.bid_price, q.ask_price, q.bid_qty, q.ask_qty)
+            .micro_price;
+    if (micro != micro)
+      return;
+    if (micro_open != micro_open) {
+      micro_open = micro_high = micro_low = micro;
+    } else {
+      micro_high = std::max(micro_high, micro);
+      micro_low = std::min(micro_low, micro);
+    }
+    micro_close = micro;
+  }
+  void close(int64_t) {
+    if (micro_open != micro_open)
+      micro_open = micro_high = micro_low = micro_close = carried_close;
+  }
+  void carry(const MicroOHLC &prev, int64_t) {
+    carried_close = prev.micro_close;
+  }
+  void reset() { *this = MicroOHLC{}; }
+};
+
+/**
+ * @brief Bar with the statistics of @p Fields (e.g.
+ * `QuoteBar<TwMid, TwSpread>`), plus window bounds and a tick count.
+ */
+template <typename... Fields> struct QuoteBar : Fields... {
+  int64_t start_time_ms = 0;
+  int64_t end_time_ms = 0;
+  uint64_t count = 0; ///< Quotes in this window (0 if only carried)
+
+  template <typename Quote> void update(const Quote &q, int64_t ts) {
+    (Fields::on_quote(q, ts), ...);
+    ++count;
+  }
+
+  void close(int64_t end_ms) { (Fields::close(end_ms), ...); }
+
+  void carry(const QuoteBar &prev, int64_t start_ms) {
+    (Fields::carry(static_cast<const Fields &>(prev), start_ms), ...);
+  }
+
+  void reset() {
+    (Fields::reset(), ...);
+    start_time_ms = end_time_ms = 0;
+    count = 0;
+  }
+};
+
+/// Every quote statistic.
+using FullQuoteBar = QuoteBar<TwMid, TwSpread, AvgTopSize, MicroOHLC>;
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "quote_bar.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Aggregates QuoteBar<Fields...> by symbol slot on event-time
+ * windows, O(1) per tick and without allocating after construction.
+ *
+ * Same layout as SlotBarAggregator: two preallocated arrays of `slots` bars
+ * that swap roles at rollover. At the boundary each bar of the closing
+ * window is closed at the window end, and the new window's bar is reset and
+ * carries the prevailing quote of the old one, so time-weighted fields stay
+ * continuous. Like MultiHorizonBarAggregator, windows follow the event time
+ * of the ticks (the first one opens them); late ticks count toward the open
+ * window.
+ *
+ * @tparam Bar A QuoteBar<Fields...>.
+ */
+template <typename Bar> class QuoteBarAggregator {
+public:
+  /**
+   * @param slots Number of symbol slots (see symbol_slot_count).
+   * @param bar_interval_ms Bar length.
+   */
+  explicit QuoteBarAggregator(size_t slots, int64_t bar_interval_ms = 60'000)
+      : interval_ms(bar_interval_ms),
+        buffers{std::vector<Bar>(slots), std::vector<Bar>(slots)} {}
+
+  /**
+   * @brief Adds a quote (anything with bid/ask price and qty, e.g.
+   * BookTicker) at event time @p timestamp_ms. Slots out of range are
+   * ignored.
+   * @return true if a new time window started (bars ready to consume)
+   */
+  template <typename Quote>
+  bool update(uint16_t slot, const Quote &quote, int64_t timestamp_ms) {
+    bool rollover_occurred = false;
+    if (!started) [[unlikely]] {
+      open_window(timestamp_ms);
+      started = true;
+    } else if (timestamp_ms >= current_window_stop_ms) {
+      roll(timestamp_ms);
+      rollover_occurred = true;
+    }
+
+    std::vector<Bar> &bars = buffers[current];
+    if (slot >= bars.size())
+      return rollover_occurred;
+    Bar &bar = bars[slot];
+    bar.update(quote, timestamp_ms);
+    bar.start_time_ms = current_window_start_ms;
+    bar.end_time_ms = current_window_stop_ms;
+    current_touched = true;
+    return rollover_occurred;
+  }
+
+  /**
+   * @brief Access the completed bars (from the previous interval), indexed
+   * by slot; empty after clear_completed(). Slots with neither ticks nor a
+   * carried quote are default bars.
+   */
+  std::span<const Bar> consume_completed_bars() const {
+    if (!completed_ready)
+      return {};
+    return buffers[current ^ 1];
+  }
+
+  /**
+   * @brief Clears the completed bars after consumption.
+   */
+  void clear_completed() { completed_ready = false; }
+
+  /**
+   * @brief Returns true if bars from the last interval are available.
+   */
+  bool has_completed_bars() const { return completed_ready; }
+
+private:
+  int64_t interval_ms;
+  int64_t current_window_start_ms = 0;
+  int64_t current_window_stop_ms = 0;
+
+  std::array<std::vector<Bar>, 2> buffers; ///< current / completed
+  size_t current = 0;           ///< Index of the buffer collecting ticks
+  bool started = false;         ///< Windows opened by the first tick
+  bool current_touched = false; ///< Current window has a tick or a carry
+  bool completed_ready = false; ///< buffers[current ^ 1] holds a window
+
+  void open_window(int64_t timestamp_ms) {
+    int64_t start = timestamp_ms / interval_ms * interval_ms;
+    if (start > timestamp_ms) // negative (pre-epoch) times round down
+      start -= interval_ms;
+    current_window_start_ms = start;
+    current_window_stop_ms = start + interval_ms;
+  }
+
+  void roll(int64_t timestamp_ms) {
+    const int64_t old_stop = current_window_stop_ms;
+    open_window(timestamp_ms);
+
+    std::vector<Bar> &done = buffers[current];
+    std::vector<Bar> &next = buffers[current ^ 1];
+    bool carried = false;
+    for (size_t slot = 0; slot < done.size(); ++slot) {
+      Bar &bar = done[slot];
+      Bar &fresh = next[slot];
+      fresh.reset();
+      if (bar.end_time_ms == 0)
+        continue; // default bar: never quoted nor carried
+      bar.close(old_stop);
+      fresh.carry(bar, current_window_start_ms);
+      fresh.start_time_ms = current_window_start_ms;
+      fresh.end_time_ms = current_window_stop_ms;
+      carried = true;
+    }
+    current ^= 1;
+    completed_ready = current_touched;
+    current_touched = carried;
+  }
+};
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "common/time_utils.hpp"
+#include "ohlc_bar.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * @brief Aggregates OHLC bars by dense symbol slot (BookTicker::slot) on
+ * synchronized time intervals, without allocating in steady state.
+ *
+ * Same contract as BarAggregator, but the bars live in two arrays of
+ * `slots` entries allocated once in the constructor. One collects the
+ * current window; at rollover the two swap roles and the new current array
+ * is reset in place, so the bar boundary costs a pointer flip and N resets
+ * instead of a hash-map rebuild. Completed bars are a contiguous span
+ * indexed by slot; slots that saw no tick have `count == 0`.
+ *
+ * @tparam Bar OHLCBar, or FixedOHLCBar to aggregate FixedBookTicker prices
+ * as integer ticks.
+ */
+template <typename Bar> class BasicSlotBarAggregator {
+public:
+  using Price = decltype(Bar::open);
+
+  /**
+   * @param slots Number of symbol slots (see symbol_slot_count).
+   * @param bar_interval_ms Bar length.
+   */
+  explicit BasicSlotBarAggregator(size_t slots,
+                                  int64_t bar_interval_ms = 60'000);
+
+  /**
+   * @brief Update bar data for a given slot and timestamped price. Slots out
+   * of range are ignored.
+   * @return true if a new time window started (bars ready to consume)
+   */
+  bool update(uint16_t slot, Price price, int64_t timestamp_ms);
+
+  /**
+   * @brief Update with a ms-since-UTC-midnight timestamp, e.g.
+   * BookTicker::event_time_ms_midnight (see BarAggregator::update_intraday).
+   * @return true if a new time window started (bars ready to consume)
+   */
+  bool update_intraday(uint16_t slot, Price price, int32_t ms_since_midnight);
+
+  /**
+   * @brief Access the completed bars (from the previous interval), indexed
+   * by slot; empty after clear_completed().
+   */
+  std::span<const Bar> consume_completed_bars() const;
+
+  /**
+   * @brief Clears the completed bars after consumption.
+   */
+  void clear_completed();
+
+  /**
+   * @brief Returns true if bars from the last interval are available.
+   */
+  bool has_completed_bars() const;
+
+private:
+  int64_t interval_ms;
+  int64_t current_window_start_ms;
+  int64_t current_window_stop_ms;
+
+  std::array<std::vector<Bar>, 2> buffers; ///< current / completed
+  size_t current = 0;           ///< Index of the buffer collecting ticks
+  bool current_touched = false; ///< Current window has seen a tick
+  bool completed_ready = false; ///< buffers[current ^ 1] holds a window
+  UtcMidnightCache day_cache;
+
+  int64_t now_ms() const;
+  int64_t get_window_start_ms(int64_t timestamp_ms) const;
+};
+
+using SlotBarAggregator = BasicSlotBarAggregator<OHLCBar>;
+using FixedSlotBarAggregator = BasicSlotBarAggregator<FixedOHLCBar>;
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "slot_bar_aggregator.hpp"
+#include <chrono>
+
+template <typename Bar>
+inline BasicSlotBarAggregator<Bar>::BasicSlotBarAggregator(
+    size_t slots, int64_t bar_interval_ms)
+    : interval_ms(bar_interval_ms),
+      buffers{std::vector<Bar>(slots), std::vector<Bar>(slots)} {
+  int64_t now = now_ms();
+  current_window_start_ms = get_window_start_ms(now);
+  current_window_stop_ms = current_window_start_ms + interval_ms;
+  day_cache.set_day(now);
+}
+
+template <typename Bar>
+inline bool BasicSlotBarAggregator<Bar>::update(uint16_t slot, Price price,
+                                                int64_t timestamp_ms) {
+  bool rollover_occurred = false;
+
+  if (timestamp_ms >= current_window_stop_ms) {
+    // Swap roles; the old completed buffer becomes current and is reset
+    current ^= 1;
+    for (Bar &bar : buffers[current])
+      bar.reset();
+    completed_ready = current_touched;
+    current_touched = false;
+
+    int64_t new_start = get_window_start_ms(timestamp_ms);
+    current_window_start_ms = new_start;
+    current_window_stop_ms = new_start + interval_ms;
+
+    rollover_occurred = true;
+  }
+
+  std::vector<Bar> &bars = buffers[current];
+  if (slot >= bars.size())
+    return rollover_occurred;
+  Bar &bar = bars[slot];
+  current_touched = true;
+  bar.update(price, timestamp_ms);
+  bar.start_time_ms = current_window_start_ms;
+  bar.end_time_ms = current_window_stop_ms;
+
+  return rollover_occurred;
+}
+
+template <typename Bar>
+inline bool
+BasicSlotBarAggregator<Bar>::update_intraday(uint16_t slot, Price price,
+                                             int32_t ms_since_midnight) {
+  return update(slot, price, day_cache.to_epoch_ms(ms_since_midnight));
+}
+
+template <typename Bar>
+inline std::span<const Bar>
+BasicSlotBarAggregator<Bar>::consume_completed_bars() const {
+  if (!completed_ready)
+    return {};
+  return buffers[current ^ 1];
+}
+
+template <typename Bar>
+inline void BasicSlotBarAggregator<Bar>::clear_completed() {
+  completed_ready = false;
+}
+
+template <typename Bar>
+inline bool BasicSlotBarAggregator<Bar>::has_completed_bars() const {
+  return completed_ready;
+}
+
+template <typename Bar>
+inline int64_t BasicSlotBarAggregator<Bar>::now_ms() const {
+  using namespace std::chrono;
+  return duration_cast<milliseconds>(system_clock::now().time_since_epoch())
+      .count();
+}
+
+template <typename Bar>
+inline int64_t
+BasicSlotBarAggregator<Bar>::get_window_start_ms(int64_t timestamp_ms) const {
+  return (timestamp_ms / interval_ms) * interval_ms;
+}
@@ -1,24 +1,36 @@
-#include "bars/bar_aggregator_impl.hpp"
-#include "bars/bar_report_printer.hpp"
-#include "bars/ohlc_bar.hpp"
+#include "common/latency_histogram.hpp"
 #include "common/price_calc.hpp"
+#include "common/thread_affinity.hpp"
+#include "common/wait_strategy.hpp"
 #include "setup_websocket.hpp"
 #include "stream_config.hpp"
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <cstdlib>
 #include <iomanip> // for std::setprecision
 #include <iostream>
 #include <ixwebsocket/IXWebSocket.h>
+#include <optional>
 #include <ranges>
 #include <string>
 #include <system_error>
 #include <thread>
-#include <unordered_map>
+#include <type_traits>
 #include <vector>
 #include <zmq.hpp>
 
+#include "bars_stage.hpp"
+#include "book_ticker_batch.hpp"
 #include "book_ticker_queue.hpp"
+#include "book_ticker_shm.hpp"
+#include "book_ticker_topic.hpp"
+#include "change_filter.hpp"
+#include "feed_arbiter.hpp"
+#include "fixed_book_ticker.hpp"
+#include "live_subscriptions.hpp"
+#include "sharded_book_ticker_queue.hpp"
 #include "symbol_id_map.hpp"
 
 std::atomic<bool> running(true);
@@ -36,7 +48,24 @@ void handle_sigint(int) {
  * - The section key in the config to select a specific stream (`key`)
  * - The path to the symbol map file (`symbol_file`)
  * - A flag if true pub to zmq (`zmqon`)
+ * - Max tickers per ZMQ frame; 1 publishes each ticker on its own
+ * (`zmq_batch`)
+ * - Shared-memory ring name for same-host consumers; empty = off (`shm`)
+ * - Shared-memory latest-quote table name; empty = off (`quotes`)
+ * - No-op update suppression before publishing (`filter`)
  * - A flag if true that dumps raw json from exchange (`debug`)
+ * - The bookTicker parser to use (`parser`)
+ * - Double or fixed-point prices up to the publish step, and the per-symbol
+ * decimals file for the latter (`prices`, `scales_file`)
+ * - The receive-timestamp clock (`clock`)
+ * - The websocket → consumer queue implementation (`queue`)
+ * - The consumer's idle wait strategy (`wait`)
+ * - Per-thread CPU / SCHED_FIFO placement (`threads`)
+ * - Number of redundant websocket connections to arbitrate (`legs`)
+ * - ZMQ REP endpoint for live (un)subscribe requests; empty = off (`control`)
+ * - Slot capacity for the symbols subscribed over a `--control` run
+ * (`max_symbols`)
+ * - In-process bars stage: price source, horizons, PUB endpoint (`bars`)
  * - A flag indicating whether all required arguments were successfully parsed
  * (`valid`)
  */
@@ -45,7 +74,22 @@ struct Args {
   std::string key;
   std::string symbol_file;
   bool zmqon = false;
+  size_t zmq_batch = 1;
+  std::string shm;
+  std::string quotes;
+  ChangeFilterConfig filter;
   bool debug = false;
+  ParserKind parser = ParserKind::Simdjson;
+  PriceMode prices = PriceMode::Double;
+  std::string scales_file;
+  ClockSource clock = ClockSource::Chrono;
+  QueueKind queue = QueueKind::Moodycamel;
+  WaitKind wait = WaitKind::Sleep;
+  ThreadPlacementMap threads;
+  int legs = 1;
+  std::string control;
+  size_t max_symbols = 1024;
+  BarsConfig bars;
   bool valid = false;
 };
 
@@ -58,6 +102,62 @@ struct Args {
  * configuration.
  * - `--symbol_file <file>`: Path to the symbol-to-ID mapping JSON file.
  *
+ * Optional arguments:
+ * - `--zmq_batch <N>`: drain up to N tickers per queue read and publish them
+ * as one batch frame per symbol (see book_ticker_batch.hpp); default 1 (one
+ * frame per ticker). Every ZMQ message is prefixed with a symbol-ID topic
+ * frame (see book_ticker_topic.hpp).
+ * - `--shm [name]`: also publish every ticker to a shared-memory broadcast
+ * ring (default name /binance_bookticker) for same-host consumers.
+ * - `--quotes [name]`: keep the latest ticker per symbol ID in a
+ * shared-memory seqlock table (default name /binance_quotes).
+ * - `--filter <policy>[,flag]`: drop updates that leave the top of book
+ * unchanged before they reach ZMQ and the shm ring; policy is `any` (any
+ * price/qty change), `price` or `qty[:threshold]` (price change or relative
+ * qty change above threshold). `,flag` only counts them. Default `off`.
+ * - `--parser <simdjson|fixed>`: bookTicker parser; `fixed` uses the
+ * fixed-layout scanner and falls back to simdjson on mismatch.
+ * - `--prices <double|fixed>`: with `fixed`, frames are parsed straight into
+ * FixedBookTicker (integer ticks and lots), which the queue carries;
+ * to_book_ticker converts to the double wire format only when publishing.
+ * Needs a single connection (no `--legs` or `"shards"`).
+ * - `--scales_file <file>`: per-symbol price/qty decimals for `--prices
+ * fixed` (e.g. config/symbol_scales.json, written by
+ * generate_symbol_files.py); symbols not in it, or every symbol without it,
+ * use 8/8 decimals.
+ * - `--clock <chrono|tsc>`: receive-timestamp clock; `tsc` reads the
+ * calibrated invariant TSC instead of calling system_clock.
+ * - `--queue <moodycamel|spsc|conflate>`: websocket → consumer queue; `spsc`
+ * is a bounded single-producer/single-consumer ring, `conflate` keeps only
+ * the latest ticker per symbol so a slow consumer skips stale quotes instead
+ * of queueing (or dropping) them.
+ * - `--wait <spin|yield|park|sleep>`: how the consumer waits when the queue
+ * is empty (busy-spin, spin then yield, spin then futex park, or 5 µs sleep).
+ * - `--pin <name=cpus[:fifo_priority]>` (repeatable) and
+ * `--pin_config <file>`: pin the `ws`, `consumer`, `bars` and `main` threads to CPU
+ * sets and optionally run them SCHED_FIFO (see thread_affinity.hpp). With
+ * `"shards": K` in the stream config (or `--legs K`) the network threads are
+ * `ws0`..`ws<K-1>`.
+ * - `--legs <N>`: open N redundant connections with the same subscriptions and
+ * publish the first arrival of each (symbol, update_id); per-leg win counts
+ * and latency advantage are reported (see feed_arbiter.hpp).
+ * - `--control <endpoint>`: serve `subscribe <symbol>...`,
+ * `unsubscribe <symbol>...` and `list` requests on a ZMQ REP socket (e.g.
+ * tcp://127.0.0.1:5556) and apply them to the live connections without a
+ * reconnect (see live_subscriptions.hpp).
+ * - `--max_symbols <N>`: with `--control`, how many distinct symbols can be
+ * subscribed over the run (default 1024, at most 65536). Symbols get dense
+ * slots 0..N-1 in subscribe order and every slot-indexed table (conflating
+ * buffer, change filter, arbiter, bars) is sized to N up front; without
+ * `--control` they are sized to the subscribed symbols.
+ * - `--bars <mid|micro|wgt>[:interval,...]`: aggregate OHLC bars of the given
+ * price on a separate `bars` thread, on exchange event time, for one or more
+ * nested intervals (e.g. `mid:1s,1m,5m`; default 1m), and publish each
+ * completed bar as a BarMessage under its symbol-ID topic on its own ZMQ PUB
+ * socket (see bars_stage.hpp).
+ * - `--bars_endpoint <endpoint>`: bind address of that socket (default
+ * tcp://0.0.0.0:5557).
+ *
  * If any arguments are missing or malformed, the function prints usage help
  * and returns an `Args` object with `valid = false`.
  *
@@ -79,13 +179,84 @@ Args parse_args(int argc, char **argv) {
       args.symbol_file = argv[++i];
     } else if (arg == "--zmqon") {
       args.zmqon = true;
+    } else if (arg == "--shm") {
+      args.shm = (i + 1 < argc && argv[i + 1][0] == '/')
+                     ? argv[++i]
+                     : kDefaultBookTickerShm;
+    } else if (arg == "--quotes") {
+      args.quotes = (i + 1 < argc && argv[i + 1][0] == '/')
+                        ? argv[++i]
+                        : kDefaultQuoteTableShm;
+    } else if (arg == "--zmq_batch" && i + 1 < argc) {
+      args.zmq_batch = std::strtoul(argv[++i], nullptr, 10);
+      if (args.zmq_batch < 1 || args.zmq_batch > kMaxBookTickerBatch) {
+        std::cerr << "❌ --zmq_batch must be in [1, " << kMaxBookTickerBatch
+                  << "]\n";
+        return args;
+      }
     } else if (arg == "--debug") {
       args.debug = true;
+    } else if (arg == "--parser" && i + 1 < argc &&
+               parse_parser_kind(argv[i + 1], args.parser)) {
+      ++i;
+    } else if (arg == "--prices" && i + 1 < argc &&
+               parse_price_mode(argv[i + 1], args.prices)) {
+      ++i;
+    } else if (arg == "--scales_file" && i + 1 < argc) {
+      args.scales_file = argv[++i];
+    } else if (arg == "--clock" && i + 1 < argc &&
+               parse_clock_source(argv[i + 1], args.clock)) {
+      ++i;
+    } else if (arg == "--filter" && i + 1 < argc &&
+               parse_change_filter(argv[i + 1], args.filter)) {
+      ++i;
+    } else if (arg == "--legs" && i + 1 < argc) {
+      args.legs = std::atoi(argv[++i]);
+      if (args.legs < 1 || args.legs > 8) {
+        std::cerr << "❌ --legs must be in [1, 8]\n";
+        return args;
+      }
+    } else if (arg == "--control" && i + 1 < argc) {
+      args.control = argv[++i];
+    } else if (arg == "--max_symbols" && i + 1 < argc) {
+      const long n = std::atol(argv[++i]);
+      if (n < 1 || n > 65536) {
+        std::cerr << "❌ --max_symbols must be in [1, 65536]\n";
+        return args;
+      }
+      args.max_symbols = static_cast<size_t>(n);
+    } else if (arg == "--bars" && i + 1 < argc &&
+               parse_bars_config(argv[i + 1], args.bars)) {
+      ++i;
+    } else if (arg == "--bars_endpoint" && i + 1 < argc) {
+      args.bars.endpoint = argv[++i];
+    } else if (arg == "--queue" && i + 1 < argc &&
+               parse_queue_kind(argv[i + 1], args.queue)) {
+      ++i;
+    } else if (arg == "--wait" && i + 1 < argc &&
+               parse_wait_kind(argv[i + 1], args.wait)) {
+      ++i;
+    } else if (arg == "--pin" && i + 1 < argc &&
+               parse_thread_placement(argv[i + 1], args.threads)) {
+      ++i;
+    } else if (arg == "--pin_config" && i + 1 < argc) {
+      try {
+        load_thread_placements(argv[++i], args.threads);
+      } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+        return args;
+      }
     } else {
       std::cerr << "❌ Unknown or malformed argument: " << arg << "\n";
       std::cerr << "✅ Usage: " << argv[0]
                 << " --config_file <file> --key <key> --symbol_file <file> "
-                   "[--debug] [--zmqon]\n";
+                   "[--debug] [--zmqon] [--zmq_batch N] [--shm [/name]] [--quotes [/name]] "
+                   "[--filter off|any|price|qty[:threshold][,flag]] "
+                   "[--parser simdjson|fixed] [--prices double|fixed] [--scales_file <file>] "
+                   "[--clock chrono|tsc] [--queue moodycamel|spsc|conflate] "
+                   "[--wait spin|yield|park|sleep] [--legs N] [--control <endpoint>] [--max_symbols N] "
+                   "[--bars mid|micro|wgt[:interval,...]] [--bars_endpoint <endpoint>] "
+                   "[--pin name=cpus[:prio]]... [--pin_config <file>]\n";
       return args;
     }
   }
@@ -96,39 +267,106 @@ Args parse_args(int argc, char **argv) {
     std::cerr << "❌ Missing required arguments.\n";
     std::cerr << "✅ Usage: " << argv[0]
               << " --config_file <file> --key <key> --symbol_file <file> "
-                 "[--debug] [--zmqon]\n";
+                 "[--debug] [--zmqon] [--zmq_batch N] [--shm [/name]] [--quotes [/name]] "
+                 "[--filter off|any|price|qty[:threshold][,flag]] "
+                 "[--parser simdjson|fixed] [--prices double|fixed] [--scales_file <file>] "
+                 "[--clock chrono|tsc] [--queue moodycamel|spsc|conflate] "
+                 "[--wait spin|yield|park|sleep] [--legs N] [--control <endpoint>] [--max_symbols N] "
+                 "[--bars mid|micro|wgt[:interval,...]] [--bars_endpoint <endpoint>] "
+                 "[--pin name=cpus[:prio]]... [--pin_config <file>]\n";
     return args;
   }
   args.valid = true;
   return args;
 }
 
-robin_hood::unordered_flat_map<int32_t, std::string>
-make_reverse_map(const SymbolIdMap &symbol_to_id) {
-  robin_hood::unordered_flat_map<int32_t, std::string> id_to_symbol;
-  for (const auto &[symbol, id] : symbol_to_id) {
-    id_to_symbol[id] = symbol;
-  }
-  return id_to_symbol;
-}
+/**
+ * @struct Outputs
+ * @brief Where consume_and_monitor publishes dequeued tickers; null members
+ * are disabled.
+ */
+struct Outputs {
+  /// ZMQ PUB socket (`--zmqon`)
+  zmq::socket_t *zmq_socket = nullptr;
+
+  /// Max tickers per ZMQ frame (`--zmq_batch`)
+  size_t zmq_batch = 1;
+
+  /// Shared-memory broadcast ring, every ticker (`--shm`)
+  BookTickerShmWriter *shm_writer = nullptr;
+
+  /// Shared-memory latest-quote table, one slot per symbol ID (`--quotes`)
+  QuoteTableWriter *quote_table = nullptr;
+
+  /// No-op update suppression ahead of ZMQ and the shm ring (`--filter`)
+  ChangeFilterConfig filter;
+
+  /// Per-symbol decimals for converting FixedBookTicker (`--prices fixed`)
+  const SymbolScaleTable *scales = nullptr;
+
+  /// In-process bars stage, fed every dequeued ticker (`--bars`)
+  BarsStage *bars = nullptr;
+};
 
-void consume_and_monitor(BookTickerQueue &queue, std::atomic<bool> &running,
-                         const SymbolIdMap &filtered_map,
-                         zmq::socket_t *zmq_socket) {
+/**
+ * @brief Drains the queue, publishes to ZMQ if enabled, and reports
+ * pipeline counters (message count, parse status, receive → dequeue latency)
+ * to stderr.
+ *
+ * Parse failures are only counted on the websocket thread; this monitor loop
+ * prints the non-zero counters and the latency histogram every
+ * `kReportInterval` while idle. When the queue is empty the loop waits
+ * according to @p wait.
+ *
+ * With `out.zmq_batch` > 1 the loop drains up to that many tickers per
+ * try_dequeue_bulk and publishes one batch frame per symbol in the burst,
+ * each under its symbol-ID topic so subscribers filter inside libzmq.
+ *
+ * Every ticker is stored in the latest-quote table when it is set. Tickers
+ * that pass the change filter (`out.filter`) are then published to the
+ * shared-memory ring and ZMQ; per-symbol suppression rates are reported with
+ * the other counters. The bars stage, when set, gets every ticker before
+ * the change filter, since qty-only updates still move micro / weighted
+ * prices.
+ *
+ * With a FixedBookTicker queue (`--prices fixed`) the change filter compares
+ * integer ticks and lots, and tickers are converted to BookTicker
+ * (to_book_ticker, `out.scales`) only where they leave the process or reach
+ * the double-based quote table and bars stage.
+ *
+ * Per-symbol state is kept in flat arrays indexed by BookTicker::slot and
+ * sized to `subscriptions.slot_capacity()`; @p subscriptions also names the
+ * slots in the reports.
+ */
+template <typename Queue>
+void consume_and_monitor(Queue &queue, std::atomic<bool> &running,
+                         LiveSubscriptions &subscriptions,
+                         const ParseCounters *parse_counters,
+                         WaitStrategy wait, const Outputs &out) {
   using clock = std::chrono::steady_clock;
   using namespace std::chrono;
+  using Ticker = queue_ticker_t<Queue>;
+  constexpr auto kReportInterval = seconds(10);
 
-  struct Stats {
-    int64_t count = 0;
-    double bid_price_sum = 0;
-    double bid_qty_sum = 0;
-    double ask_price_sum = 0;
-    double ask_qty_sum = 0;
-    double latency_sum_ms = 0;
+  zmq::socket_t *zmq_socket = out.zmq_socket;
+  const size_t zmq_batch = out.zmq_batch;
+  std::vector<Ticker> batch(std::max<size_t>(zmq_batch, 1));
+  std::vector<BookTicker> wire;
+  if constexpr (std::is_same_v<Ticker, FixedBookTicker>)
+    wire.resize(batch.size());
+  // The first count tickers of batch in the double wire format
+  auto to_wire = [&](size_t count) -> BookTicker * {
+    if constexpr (std::is_same_v<Ticker, FixedBookTicker>) {
+      for (size_t i = 0; i < count; ++i)
+        wire[i] = to_book_ticker(batch[i], (*out.scales)[batch[i].id]);
+      return wire.data();
+    } else {
+      return batch.data();
+    }
   };
-
-  std::unordered_map<int32_t, Stats> stats_by_id;
-  BookTicker msg;
+  std::optional<BookTickerTopicPublisher> publisher;
+  if (zmq_socket)
+    publisher.emplace(*zmq_socket, batch.size());
 
   if (zmq_socket)
     std::cerr << "zmq enabled" << std::endl;
@@ -136,29 +374,266 @@ void consume_and_monitor(BookTickerQueue &queue, std::atomic<bool> &running,
     std::cerr << "zmq off" << std::endl;
   std::cerr << std::flush << std::endl;
   auto last_report = clock::now();
-  auto id_to_symbol = make_reverse_map(filtered_map);
+  BasicChangeFilter<Ticker> change_filter(out.filter,
+                                          subscriptions.slot_capacity());
+  std::vector<std::string> slot_names;
+  size_t named_slots = 0;
   uint32_t cnt = 0;
   uint32_t send = 0;
+  LatencyHistogram dequeue_latency;
   while (running) {
-    if (queue.try_dequeue(msg)) {
-      if (zmq_socket) {
-        zmq::message_t zmq_msg(sizeof(msg));
-        memcpy(zmq_msg.data(), &msg, sizeof(msg));
-        zmq_socket->send(zmq_msg, zmq::send_flags::none);
+    size_t n = zmq_batch > 1
+                   ? queue.try_dequeue_bulk(batch.begin(), zmq_batch)
+                   : static_cast<size_t>(queue.try_dequeue(batch[0]));
+    if (n) {
+      wait.reset();
+      int64_t now = receive_time_ns();
+      for (size_t i = 0; i < n; ++i)
+        dequeue_latency.record(now - batch[i].my_receive_time_ns);
+      if (out.quote_table || out.bars) {
+        const BookTicker *all = to_wire(n);
+        if (out.quote_table) {
+          for (size_t i = 0; i < n; ++i)
+            out.quote_table->store(static_cast<uint64_t>(all[i].id), all[i]);
+        }
+        if (out.bars)
+          out.bars->push(all, n);
+      }
+      uint32_t prev = cnt;
+      cnt += static_cast<uint32_t>(n);
+      if (cnt / 5000 != prev / 5000 || cnt < 10) {
+        std::cerr << "msg cnt = " << cnt << std::endl;
+      }
+      n = change_filter.filter(batch.data(), n);
+      if (n == 0)
+        continue;
+      const BookTicker *kept = to_wire(n);
+      if (out.shm_writer) {
+        for (size_t i = 0; i < n; ++i)
+          out.shm_writer->publish(kept[i]);
+      }
+      const BookTicker &msg = kept[0];
+      if (publisher) {
+        size_t messages = publisher->publish(kept, n);
         if (++send < 10)
           std::cerr << "sending msg " << msg.id << " " << msg.bid_price
+                    << " (" << n << " in " << messages << " topics)"
                     << std::endl;
       }
-      if (++cnt % 5000 == 0 || cnt < 10) {
-        std::cerr << "msg cnt = " << cnt << std::endl;
-      }
     } else {
-      std::this_thread::sleep_for(std::chrono::microseconds(5));
+      if (clock::now() - last_report >= kReportInterval) {
+        if (parse_counters)
+          parse_counters->print(std::cerr);
+        // Queue-specific counters (conflation, per-shard rate/latency)
+        if constexpr (requires { queue.print(std::cerr); })
+          queue.print(std::cerr);
+        if (change_filter.enabled()) {
+          // Refresh only after a subscribe added slots: it takes the
+          // control lock
+          if (subscriptions.slots_used() != named_slots) {
+            named_slots = subscriptions.slots_used();
+            slot_names = subscriptions.slot_names();
+          }
+          change_filter.print(std::cerr, [&](size_t slot) -> std::string_view {
+            return slot_names[slot];
+          });
+          change_filter.reset_counters();
+        }
+        dequeue_latency.print(std::cerr, "dequeue latency");
+        dequeue_latency.reset();
+        last_report = clock::now();
+      }
+      wait.idle([&queue] { return queue.size_approx() > 0; });
     }
   }
   std::cout << "🛑 Consumer thread exiting...\n";
 }
 
+/**
+ * @brief Connects the websocket to a consumer thread through a @p Queue and
+ * runs until Ctrl+C.
+ *
+ * @tparam Queue BookTickerQueue, SpscBookTickerQueue or
+ * ConflatingBookTickerBuffer (see `--queue`), or their FixedBookTicker
+ * counterparts (`--prices fixed`).
+ */
+template <typename Queue>
+void run_pipeline(const Args &args, const StreamConfig &stream_config,
+                  LiveSubscriptions &subscriptions, const Outputs &out) {
+  std::unique_ptr<Queue> queue;
+  if constexpr (std::is_same_v<Queue, ConflatingBookTickerBuffer> ||
+                std::is_same_v<Queue, ConflatingFixedBookTickerBuffer>)
+    queue = std::make_unique<Queue>(subscriptions.slot_capacity());
+  else
+    queue = std::make_unique<Queue>();
+  ParseCounters parse_counters;
+  Doorbell doorbell;
+  ix::WebSocket ws;
+  setup_websocket(ws, stream_config, subscriptions, queue.get(), args.debug,
+                  args.parser, &parse_counters,
+                  args.wait == WaitKind::SpinPark ? &doorbell : nullptr,
+                  &args.threads, "ws", out.scales);
+  std::thread consumer_thread([&] {
+    apply_thread_placement("consumer", args.threads);
+    consume_and_monitor(*queue, running, subscriptions, &parse_counters,
+                        WaitStrategy(args.wait, &doorbell), out);
+  });
+  ws.start();
+  // After start() so the ws thread does not inherit the main placement
+  apply_thread_placement("main", args.threads);
+
+  std::cout << "🟢 WebSocket client running. Press Ctrl+C to exit.\n";
+
+  // Poll until Ctrl+C is pressed
+  while (running) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  std::cout << "🔻 Stopping WebSocket...\n";
+  ws.stop();
+  consumer_thread.join();
+}
+
+/**
+ * @brief Runs one websocket connection per entry of @p configs, connection k
+ * enqueueing into `producer_of(k)` on its own IXWebSocket thread (placement
+ * name "ws<k>"), and a consumer draining the merged @p queue until Ctrl+C.
+ *
+ * @param kind Connection label for log lines ("shard" or "leg").
+ */
+template <typename MergedQueue, typename ProducerOf>
+void run_connections(const Args &args, const std::vector<StreamConfig> &configs,
+                     const char *kind, MergedQueue &queue,
+                     ProducerOf producer_of, LiveSubscriptions &subscriptions,
+                     const Outputs &out) {
+  ParseCounters parse_counters;
+  Doorbell doorbell;
+  std::vector<std::unique_ptr<ix::WebSocket>> sockets;
+  for (size_t k = 0; k < configs.size(); ++k) {
+    sockets.push_back(std::make_unique<ix::WebSocket>());
+    setup_websocket(*sockets[k], configs[k], subscriptions, &producer_of(k),
+                    args.debug, args.parser, &parse_counters,
+                    args.wait == WaitKind::SpinPark ? &doorbell : nullptr,
+                    &args.threads, "ws" + std::to_string(k));
+    std::cerr << "✅ " << kind << ' ' << k << ": " << configs[k].subs.size()
+              << " symbols\n";
+  }
+  std::thread consumer_thread([&] {
+    apply_thread_placement("consumer", args.threads);
+    consume_and_monitor(queue, running, subscriptions, &parse_counters,
+                        WaitStrategy(args.wait, &doorbell), out);
+  });
+  for (auto &ws : sockets)
+    ws->start();
+  apply_thread_placement("main", args.threads);
+
+  std::cout << "🟢 " << sockets.size() << " WebSocket " << kind
+            << "s running. Press Ctrl+C to exit.\n";
+  while (running) {
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+
+  std::cout << "🔻 Stopping WebSockets...\n";
+  for (auto &ws : sockets)
+    ws->stop();
+  consumer_thread.join();
+}
+
+/**
+ * @brief Like run_pipeline, but with the subscriptions split across
+ * `stream_config.shards` websocket connections, each handing off through its
+ * own SPSC ring; the consumer merges the rings (ShardedBookTickerQueue) and
+ * reports per-shard rate and latency. `--queue` does not apply.
+ */
+void run_sharded_pipeline(const Args &args, const StreamConfig &stream_config,
+                          LiveSubscriptions &subscriptions, const Outputs &out) {
+  std::vector<StreamConfig> configs = shard_stream_config(stream_config);
+  ShardedBookTickerQueue queue(configs.size());
+  run_connections(
+      args, configs, "shard", queue,
+      [&](size_t k) -> SpscBookTickerQueue & { return queue.shard(k); },
+      subscriptions, out);
+}
+
+/**
+ * @brief Like run_pipeline, but with `--legs` redundant connections carrying
+ * the full subscription list; ArbitratedBookTickerQueue publishes the first
+ * arrival of each (symbol, update_id) and reports which leg won and by how
+ * much. `--queue` does not apply.
+ */
+void run_redundant_pipeline(const Args &args, const StreamConfig &stream_config,
+                            LiveSubscriptions &subscriptions,
+                            const Outputs &out) {
+  std::vector<StreamConfig> configs(static_cast<size_t>(args.legs),
+                                    stream_config);
+  ArbitratedBookTickerQueue queue(configs.size(),
+                                  subscriptions.slot_capacity());
+  run_connections(
+      args, configs, "leg", queue,
+      [&](size_t k) -> SpscBookTickerQueue & { return queue.leg(k); },
+      subscriptions, out);
+}
+
+/**
+ * @brief Serves control requests (see LiveSubscriptions::handle) on a ZMQ REP
+ * socket bound to @p endpoint until Ctrl+C.
+ *
+ * Receives with a short timeout so it notices shutdown, and uses idle time to
+ * free lookups the parse threads have moved past.
+ */
+void run_control_channel(zmq::context_t &context, const std::string &endpoint,
+                         LiveSubscriptions &subscriptions) {
+  zmq::socket_t socket(context, zmq::socket_type::rep);
+  try {
+    socket.set(zmq::sockopt::rcvtimeo, 200);
+    socket.set(zmq::sockopt::linger, 0);
+    socket.bind(endpoint);
+  } catch (const zmq::error_t &e) {
+    std::cerr << "❌ control channel " << endpoint << ": " << e.what() << "\n";
+    return;
+  }
+  std::cerr << "✅ control channel on " << endpoint << "\n";
+  while (running) {
+    zmq::message_t request;
+    if (!socket.recv(request, zmq::recv_flags::none)) {
+      subscriptions.pending_reclaim();
+      continue;
+    }
+    std::string reply = subscriptions.handle(request.to_string_view());
+    std::cerr << "📌 control: " << request.to_string_view() << " -> " << reply
+              << "\n";
+    socket.send(zmq::buffer(reply.data(), reply.size()),
+                zmq::send_flags::none);
+  }
+}
+
+/**
+ * @brief Runs the bars stage (see BarsStage) until Ctrl+C, publishing
+ * completed bars on a ZMQ PUB socket bound to `cfg.endpoint`.
+ *
+ * Bars are not latency-critical, so the thread sleeps when idle rather than
+ * following `--wait`.
+ */
+void run_bars_stage(zmq::context_t &context, const BarsConfig &cfg,
+                    BarsStage &stage) {
+  zmq::socket_t socket(context, zmq::socket_type::pub);
+  try {
+    socket.set(zmq::sockopt::sndhwm, 10000);
+    socket.set(zmq::sockopt::linger, 0);
+    socket.bind(cfg.endpoint);
+  } catch (const zmq::error_t &e) {
+    std::cerr << "❌ bars socket " << cfg.endpoint << ": " << e.what() << "\n";
+    return;
+  }
+  std::cerr << "✅ bars (" << to_string(cfg.price) << ") on " << cfg.endpoint
+            << "\n";
+  stage.run(running, WaitStrategy(WaitKind::Sleep),
+            [&socket](std::span<const BarMessage> bars) {
+              publish_bars(socket, bars);
+            });
+  stage.print(std::cerr);
+}
+
 /**
  * @brief Entry point for the Binance WebSocket client application.
  *
@@ -242,6 +717,19 @@ int main(int argc, char **argv) {
     }
   }
 
+  std::unique_ptr<BookTickerShmWriter> shm_writer;
+  if (!args.shm.empty()) {
+    try {
+      shm_writer = std::make_unique<BookTickerShmWriter>(args.shm,
+                                                         kBookTickerShmSlots);
+      std::cerr << "✅ shm ring " << args.shm << " (" << kBookTickerShmSlots
+                << " slots)\n";
+    } catch (const std::exception &e) {
+      std::cerr << e.what() << "\n";
+      return 1;
+    }
+  }
+
   // Setup and start WebSocket
   const StreamConfig &stream_config = cfgmap[args.key];
 
@@ -249,23 +737,126 @@ int main(int argc, char **argv) {
   SymbolIdMap filtered_map =
       filter_symbol_map(complete_map, stream_config.subs);
 
-  BookTickerQueue queue;
-  ix::WebSocket ws;
-  setup_websocket(ws, stream_config, filtered_map, &queue, args.debug);
-  std::thread consumer_thread(consume_and_monitor, std::ref(queue),
-                              std::ref(running), filtered_map,
-                              zmq_socket.get());
-  ws.start();
+  // Dense slots 0..N-1 for the subscribed symbols; with --control symbols
+  // added later take the next slots, up to --max_symbols
+  const bool live = !args.control.empty();
+  if (live && args.max_symbols < filtered_map.size()) {
+    std::cerr << "❌ --max_symbols " << args.max_symbols << " is below the "
+              << filtered_map.size() << " subscribed symbols\n";
+    return 1;
+  }
+  LiveSubscriptions subscriptions(
+      complete_map, filtered_map,
+      live ? args.max_symbols : filtered_map.size(),
+      /*redundant=*/args.legs > 1);
 
-  std::cout << "🟢 WebSocket client running. Press Ctrl+C to exit.\n";
+  std::unique_ptr<QuoteTableWriter> quote_table;
+  if (!args.quotes.empty()) {
+    try {
+      quote_table = std::make_unique<QuoteTableWriter>(
+          args.quotes, symbol_id_span(live ? complete_map : filtered_map));
+      std::cerr << "✅ shm quote table " << args.quotes << " ("
+                << quote_table->size() << " slots)\n";
+    } catch (const std::exception &e) {
+      std::cerr << e.what() << "\n";
+      return 1;
+    }
+  }
 
-  // Poll until Ctrl+C is pressed
-  while (running) {
-    std::this_thread::sleep_for(std::chrono::seconds(1));
+  const bool fixed_prices = args.prices == PriceMode::Fixed;
+  if (fixed_prices && (args.legs > 1 || stream_config.shards > 1)) {
+    std::cerr << "❌ --prices fixed needs a single connection (no --legs or "
+                 "\"shards\")\n";
+    return 1;
+  }
+  SymbolScaleTable scales;
+  if (fixed_prices) {
+    if (args.scales_file.empty()) {
+      std::cerr << "⚠️ No --scales_file: every symbol uses 8/8 decimals\n";
+    } else {
+      try {
+        scales = load_symbol_scales(args.scales_file, complete_map);
+      } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+      }
+      std::cerr << "✅ fixed-point prices, scales from " << args.scales_file
+                << "\n";
+    }
   }
 
-  std::cout << "🔻 Stopping WebSocket...\n";
-  ws.stop();
-  consumer_thread.join();
+  Outputs out;
+  out.zmq_socket = zmq_socket.get();
+  out.zmq_batch = args.zmq_batch;
+  out.shm_writer = shm_writer.get();
+  out.quote_table = quote_table.get();
+  out.filter = args.filter;
+  if (fixed_prices)
+    out.scales = &scales;
+
+  std::unique_ptr<BarsStage> bars_stage;
+  if (args.bars.enabled) {
+    bars_stage =
+        std::make_unique<BarsStage>(args.bars, subscriptions.slot_capacity());
+    out.bars = bars_stage.get();
+  }
+
+  if (!select_receive_clock(args.clock)) {
+    std::cerr << "⚠️ No invariant TSC; using chrono receive clock\n";
+  } else if (args.clock == ClockSource::Tsc) {
+    std::cerr << "✅ TSC receive clock: "
+              << receive_clock_detail::tsc_clock().ticks_per_ns()
+              << " ticks/ns\n";
+  }
+
+  std::unique_ptr<zmq::context_t> control_context;
+  std::thread control_thread;
+  if (!args.control.empty()) {
+    control_context = std::make_unique<zmq::context_t>(1);
+    control_thread = std::thread([&] {
+      run_control_channel(*control_context, args.control, subscriptions);
+    });
+  }
+
+  std::unique_ptr<zmq::context_t> bars_context;
+  std::thread bars_thread;
+  if (bars_stage) {
+    bars_context = std::make_unique<zmq::context_t>(1);
+    bars_thread = std::thread([&] {
+      apply_thread_placement("bars", args.threads);
+      run_bars_stage(*bars_context, args.bars, *bars_stage);
+    });
+  }
+
+  if (args.legs > 1) {
+    if (stream_config.shards > 1)
+      std::cerr << "⚠️ \"shards\" ignored: every leg carries all symbols\n";
+    if (args.queue != QueueKind::Moodycamel)
+      std::cerr << "⚠️ --queue ignored: each leg uses an SPSC ring\n";
+    run_redundant_pipeline(args, stream_config, subscriptions, out);
+  } else if (stream_config.shards > 1) {
+    if (args.queue != QueueKind::Moodycamel)
+      std::cerr << "⚠️ --queue ignored: each shard uses an SPSC ring\n";
+    run_sharded_pipeline(args, stream_config, subscriptions, out);
+  } else if (fixed_prices && args.queue == QueueKind::Conflate) {
+    run_pipeline<ConflatingFixedBookTickerBuffer>(args, stream_config,
+                                                  subscriptions, out);
+  } else if (fixed_prices && args.queue == QueueKind::Spsc) {
+    run_pipeline<SpscFixedBookTickerQueue>(args, stream_config, subscriptions,
+                                           out);
+  } else if (fixed_prices) {
+    run_pipeline<FixedBookTickerQueue>(args, stream_config, subscriptions, out);
+  } else if (args.queue == QueueKind::Conflate) {
+    run_pipeline<ConflatingBookTickerBuffer>(args, stream_config, subscriptions,
+                                             out);
+  } else if (args.queue == QueueKind::Spsc) {
+    run_pipeline<SpscBookTickerQueue>(args, stream_config, subscriptions, out);
+  } else {
+    run_pipeline<BookTickerQueue>(args, stream_config, subscriptions, out);
+  }
+  if (control_thread.joinable())
+    control_thread.join();
+  if (bars_thread.joinable())
+    bars_thread.join();
   return 0;
 }
@@ -0,0 +1,278 @@
+#pragma once
+
+#include "bars/bar_message.hpp"
+#include "bars/multi_horizon_bar_aggregator_impl.hpp"
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "book_ticker_topic.hpp"
+#include "common/price_calc.hpp"
+#include "common/wait_strategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zmq.hpp>
+
+/// Default bars PUB endpoint (`--bars_endpoint`); tickers stay on 5555.
+inline constexpr const char *kDefaultBarsEndpoint = "tcp://0.0.0.0:5557";
+
+/**
+ * @struct BarsConfig
+ * @brief Bars stage settings (`--bars`, `--bars_endpoint`).
+ */
+struct BarsConfig {
+  bool enabled = false;
+  BarPriceSource price = BarPriceSource::Mid;
+
+  /// Bar lengths, ascending and nested (see MultiHorizonBarAggregator)
+  std::vector<int64_t> horizons_ms = {60'000};
+
+  std::string endpoint = kDefaultBarsEndpoint;
+};
+
+/// CLI name of a BarPriceSource.
+inline const char *to_string(BarPriceSource source) {
+  switch (source) {
+  case BarPriceSource::Mid:
+    return "mid";
+  case BarPriceSource::Micro:
+    return "micro";
+  case BarPriceSource::Weighted:
+    return "wgt";
+  }
+  return "unknown";
+}
+
+/// Parses "250ms", "1s", "5m", "1h" or a bare number of ms; 0 if malformed.
+inline int64_t parse_bar_interval_ms(std::string_view spec) {
+  std::string value(spec);
+  char *end = nullptr;
+  int64_t n = std::strtoll(value.c_str(), &end, 10);
+  std::string_view unit(end);
+  if (value.empty() || end == value.c_str() || n <= 0)
+    return 0;
+  if (unit.empty() || unit == "ms")
+    return n;
+  if (unit == "s")
+    return n * 1'000;
+  if (unit == "m")
+    return n * 60'000;
+  if (unit == "h")
+    return n * 3'600'000;
+  return 0;
+}
+
+/**
+ * @brief Parses `mid`, `micro` or `wgt`, optionally followed by
+ * `:interval[,interval...]` (e.g. "micro:1s,1m,5m"); default interval 1m.
+ * @return false if the spec is malformed or the intervals do not nest.
+ */
+inline bool parse_bars_config(std::string_view spec, BarsConfig &cfg) {
+  BarsConfig out;
+  out.endpoint = cfg.endpoint;
+  std::string_view name = spec.substr(0, spec.find(':'));
+  if (name == "mid") {
+    out.price = BarPriceSource::Mid;
+  } else if (name == "micro") {
+    out.price = BarPriceSource::Micro;
+  } else if (name == "wgt") {
+    out.price = BarPriceSource::Weighted;
+  } else {
+    return false;
+  }
+  if (name.size() < spec.size()) {
+    out.horizons_ms.clear();
+    std::string_view list = spec.substr(name.size() + 1);
+    while (true) {
+      size_t comma = list.find(',');
+      int64_t interval = parse_bar_interval_ms(list.substr(0, comma));
+      if (interval == 0 || interval > INT32_MAX)
+        return false;
+      if (!out.horizons_ms.empty() &&
+          (interval <= out.horizons_ms.back() ||
+           interval % out.horizons_ms.back() != 0))
+        return false;
+      out.horizons_ms.push_back(interval);
+      if (comma == std::string_view::npos)
+        break;
+      list = list.substr(comma + 1);
+    }
+  }
+  out.enabled = true;
+  cfg = out;
+  return true;
+}
+
+/// The @p source price of a ticker's top of book; NaN when undefined.
+inline double bar_price(const BookTicker &bt, BarPriceSource source) {
+  if (source == BarPriceSource::Mid)
+    return 0.5 * (bt.bid_price + bt.ask_price);
+  Prices prices =
+      compute_prices(bt.bid_price, bt.ask_price, bt.bid_qty, bt.ask_qty);
+  return source == BarPriceSource::Micro ? prices.micro_price
+                                         : prices.wgt_price;
+}
+
+/**
+ * @class BarsStage
+ * @brief In-process OHLC bars off the live ticker stream, on its own thread.
+ *
+ * The consumer thread push()es every dequeued ticker into an SPSC ring and
+ * never waits on it; a full ring drops and counts. The bars thread pops the
+ * ring, turns each ticker into a price (BarsConfig::price), aggregates it with
+ * a MultiHorizonBarAggregator on exchange event time ("E") and hands the
+ * bars of every completed window to a publish callback, normally
+ * publish_bars() on a separate ZMQ PUB socket. Downstream consumers then get
+ * bars without reprocessing every tick.
+ *
+ * The UTC day of the midnight-relative event times is anchored on the
+ * receive time of the first ticker.
+ */
+class BarsStage {
+public:
+  /**
+   * @param cfg Price source and horizons.
+   * @param slots Slot capacity (see LiveSubscriptions::slot_capacity);
+   * tickers with a slot at or above it are ignored.
+   */
+  BarsStage(const BarsConfig &cfg, size_t slots)
+      : cfg_(cfg), ring_(std::make_unique<SpscBookTickerQueue>()),
+        aggregator_(slots, cfg.horizons_ms), slot_ids_(slots, -1) {
+    scratch_.reserve(slots);
+  }
+
+  /// Consumer thread: hands @p n tickers to the stage without blocking.
+  void push(const BookTicker *tickers, size_t n) {
+    size_t taken = ring_->try_enqueue_bulk(tickers, n);
+    if (taken < n)
+      dropped_.fetch_add(n - taken, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Bars thread: aggregates whatever is queued.
+   * @param publish Called as `publish(std::span<const BarMessage>)` once per
+   * completed window of each horizon that saw ticks.
+   * @return tickers consumed.
+   */
+  template <typename Publish> size_t process(Publish &&publish) {
+    BookTicker batch[64];
+    size_t total = 0;
+    while (size_t n = ring_->try_dequeue_bulk(batch, std::size(batch))) {
+      for (size_t i = 0; i < n; ++i)
+        add(batch[i], publish);
+      total += n;
+    }
+    tickers_ += total;
+    return total;
+  }
+
+  /**
+   * @brief Bars thread main loop: process() until @p running is cleared,
+   * waiting per @p wait when idle and printing counters every 10 s.
+   */
+  template <typename Publish>
+  void run(const std::atomic<bool> &running, WaitStrategy wait,
+           Publish &&publish) {
+    using clock = std::chrono::steady_clock;
+    constexpr auto kReportInterval = std::chrono::seconds(10);
+    auto last_report = clock::now();
+    while (running) {
+      if (process(publish)) {
+        wait.reset();
+        continue;
+      }
+      if (clock::now() - last_report >= kReportInterval) {
+        print(std::cerr);
+        last_report = clock::now();
+      }
+      wait.idle([this] { return ring_->size_approx() > 0; });
+    }
+  }
+
+  /// Tickers aggregated so far (bars thread).
+  uint64_t tickers() const { return tickers_; }
+
+  /// Bars handed to publish so far (bars thread).
+  uint64_t bars() const { return bars_; }
+
+  /// Tickers lost to a full ring.
+  uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+  void print(std::ostream &os) const {
+    os << "bars (" << to_string(cfg_.price) << "): " << tickers_
+       << " tickers, " << bars_ << " bars published";
+    if (uint64_t d = dropped())
+      os << ", ⚠️ " << d << " dropped";
+    os << '\n';
+  }
+
+private:
+  template <typename Publish> void add(const BookTicker &bt, Publish &publish) {
+    double price = bar_price(bt, cfg_.price);
+    if (!std::isfinite(price))
+      return;
+    if (bt.slot < slot_ids_.size())
+      slot_ids_[bt.slot] = bt.id; // A slot's ID never changes
+    if (!day_set_) [[unlikely]] {
+      aggregator_.set_day(bt.my_receive_time_ns / 1'000'000);
+      day_set_ = true;
+    }
+    if (!aggregator_.update_intraday(bt.slot, price, bt.event_time_ms_midnight))
+      return;
+    for (size_t h = 0; h < aggregator_.horizons(); ++h) {
+      if (!aggregator_.has_completed_bars(h))
+        continue;
+      collect(h);
+      aggregator_.clear_completed(h);
+      if (!scratch_.empty()) {
+        publish(std::span<const BarMessage>(scratch_));
+        bars_ += scratch_.size();
+      }
+    }
+  }
+
+  void collect(size_t h) {
+    scratch_.clear();
+    std::span<const OHLCBar> bars = aggregator_.consume_completed_bars(h);
+    const int32_t interval = static_cast<int32_t>(aggregator_.interval_ms(h));
+    for (size_t slot = 0; slot < bars.size(); ++slot) {
+      if (bars[slot].count)
+        scratch_.push_back(make_bar_message(bars[slot], slot_ids_[slot], slot,
+                                            interval, cfg_.price));
+    }
+  }
+
+  BarsConfig cfg_;
+  std::unique_ptr<SpscBookTickerQueue> ring_; ///< consumer → bars thread
+  MultiHorizonBarAggregator aggregator_;
+  std::vector<int32_t> slot_ids_;   ///< slot → global symbol ID, as seen
+  std::vector<BarMessage> scratch_; ///< One horizon's completed bars
+  bool day_set_ = false;
+  uint64_t tickers_ = 0;
+  uint64_t bars_ = 0;
+  std::atomic<uint64_t> dropped_{0};
+};
+
+/// Sends each bar as a [book_ticker_topic(id) | BarMessage] message.
+inline void publish_bars(zmq::socket_t &socket,
+                         std::span<const BarMessage> bars) {
+  for (const BarMessage &bar : bars) {
+    zmq::message_t topic(kBookTickerTopicBytes);
+    const int32_t id = bar.id;
+    std::memcpy(topic.data(), &id, kBookTickerTopicBytes);
+    socket.send(topic, zmq::send_flags::sndmore);
+    zmq::message_t payload(sizeof(BarMessage));
+    std::memcpy(payload.data(), &bar, sizeof(BarMessage));
+    socket.send(payload, zmq::send_flags::none);
+  }
+}
@@ -11,7 +11,8 @@
  *
  * This struct is used to capture the Binance `bookTicker` stream data
  * specifically for perpetual contracts. It includes bid/ask prices and
- * quantities, update ID, event and trade timestamps, and an internal symbol ID.
+ * quantities, update ID, event and trade timestamps, and a global symbol ID
+ * alongside the symbol's dense per-stream slot.
  *
  * Note: Binance Spot `bookTicker` messages do not include all of these fields
  * (e.g., `trade_time` and `update_id` may be missing).
@@ -43,8 +44,13 @@ struct alignas(64) BookTicker {
   /// reported by Binance ("E") converted to ms from midnight
   int32_t event_time_ms_midnight;
 
-  /// Internal integer symbol ID (e.g., 0 = BTCUSDT)
-  int32_t id;
+  /// Global symbol ID from the symbol file (e.g., 290 = BTCUSDT); what goes
+  /// on the wire and into ZMQ topics
+  int16_t id;
+
+  /// Dense per-stream index 0..N-1 of the subscribed symbol (see
+  /// SymbolSlotMap), for array-indexed per-symbol state in the hot path
+  uint16_t slot;
 
   /// Receive time in nanoseconds from epoch
   int64_t my_receive_time_ns;
@@ -53,3 +59,9 @@ struct alignas(64) BookTicker {
 static_assert(sizeof(BookTicker) == 64, "BookTicker must be 64 bytes");
 static_assert(std::is_trivially_copyable<BookTicker>::value,
               "BookTicker must be trivially copyable");
+
+/// Exact top-of-book comparison (prices and quantities only).
+inline bool same_top_of_book(const BookTicker &a, const BookTicker &b) {
+  return a.bid_price == b.bid_price && a.ask_price == b.ask_price &&
+         a.bid_qty == b.bid_qty && a.ask_qty == b.ask_qty;
+}
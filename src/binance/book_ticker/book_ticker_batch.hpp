@@ -0,0 +1,86 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <zmq.hpp>
+
+/**
+ * @brief Wire format for batched BookTicker publishing over ZMQ.
+ *
+ * A batch frame is an 8-byte header followed by `count` raw 64-byte
+ * BookTicker structs:
+ *
+ *   [ magic:u32 | count:u32 ][ BookTicker × count ]
+ *
+ * Batch frames are never exactly sizeof(BookTicker) bytes long, so a
+ * subscriber can accept both single-ticker and batch frames on one socket.
+ */
+struct BookTickerBatchHeader {
+  uint32_t magic;
+  uint32_t count;
+};
+
+static_assert(sizeof(BookTickerBatchHeader) == 8,
+              "BookTickerBatchHeader must be 8 bytes");
+
+/// "BTB2" little-endian; the digit is the BookTicker layout version (2: `int16_t
+/// id` + `uint16_t slot`), so old subscribers reject newer batches
+inline constexpr uint32_t kBookTickerBatchMagic = 0x32425442;
+
+/// Upper bound on tickers per batch accepted by decode_book_ticker_batch.
+inline constexpr uint32_t kMaxBookTickerBatch = 4096;
+
+inline constexpr size_t book_ticker_batch_bytes(size_t count) {
+  return sizeof(BookTickerBatchHeader) + count * sizeof(BookTicker);
+}
+
+/**
+ * @brief Packs @p count tickers into one ZMQ message (one allocation and one
+ * copy per batch instead of per ticker).
+ */
+inline zmq::message_t encode_book_ticker_batch(const BookTicker *tickers,
+                                               size_t count) {
+  zmq::message_t msg(book_ticker_batch_bytes(count));
+  auto *p = static_cast<char *>(msg.data());
+  BookTickerBatchHeader header{kBookTickerBatchMagic,
+                               static_cast<uint32_t>(count)};
+  std::memcpy(p, &header, sizeof(header));
+  std::memcpy(p + sizeof(header), tickers, count * sizeof(BookTicker));
+  return msg;
+}
+
+/**
+ * @brief Calls @p fn(const BookTicker &) for each ticker in a received frame,
+ * single or batch.
+ *
+ * @return number of tickers delivered, or -1 if the frame is neither a
+ * BookTicker nor a well-formed batch.
+ */
+template <typename Fn>
+inline int64_t decode_book_ticker_batch(const void *data, size_t size,
+                                        Fn &&fn) {
+  BookTicker bt;
+  if (size == sizeof(BookTicker)) {
+    std::memcpy(&bt, data, sizeof(bt));
+    fn(static_cast<const BookTicker &>(bt));
+    return 1;
+  }
+
+  BookTickerBatchHeader header;
+  if (size < sizeof(header))
+    return -1;
+  std::memcpy(&header, data, sizeof(header));
+  if (header.magic != kBookTickerBatchMagic ||
+      header.count > kMaxBookTickerBatch ||
+      size != book_ticker_batch_bytes(header.count))
+    return -1;
+
+  const char *p = static_cast<const char *>(data) + sizeof(header);
+  for (uint32_t i = 0; i < header.count; ++i, p += sizeof(BookTicker)) {
+    std::memcpy(&bt, p, sizeof(bt));
+    fn(static_cast<const BookTicker &>(bt));
+  }
+  return header.count;
+}
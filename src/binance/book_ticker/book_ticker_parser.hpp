@@ -2,9 +2,16 @@
 #pragma once
 #include "book_ticker.hpp"
 #include "common/time_utils.hpp"
-#include "symbol_id_map.hpp"
+#include "common/tsc_clock.hpp"
+#include "parse_status.hpp"
+#include "symbol_lookup_table.hpp"
+#include <algorithm>
+#include <cstring>
 #include <fast_float/fast_float.h>
 #include <simdjson.h>
+#include <string>
+#include <string_view>
+#include <vector>
 
 inline bool field_exists(simdjson::ondemand::object obj,
                          const std::string &field) {
@@ -12,22 +19,61 @@ inline bool field_exists(simdjson::ondemand::object obj,
   return result.error() == simdjson::SUCCESS;
 }
 
+/// Initial size of the per-thread scratch buffer; bookTicker frames are
+/// ~170 bytes so this is never grown in practice.
+inline constexpr size_t kParseScratchBytes = 1024;
+
+/**
+ * @brief Returns a simdjson padded view over a raw frame without allocating.
+ *
+ * If the caller's buffer already has SIMDJSON_PADDING bytes of slack after the
+ * payload (`capacity >= len + SIMDJSON_PADDING`) it is parsed in place.
+ * Otherwise the payload is copied into a thread-local scratch buffer that only
+ * ever grows, so steady-state parsing performs no heap allocation.
+ *
+ * The returned view is valid until the next call on the same thread.
+ *
+ * @param data     Pointer to the JSON bytes.
+ * @param len      Number of JSON bytes.
+ * @param capacity Number of readable bytes starting at @p data (>= len).
+ */
+inline simdjson::padded_string_view padded_frame(const char *data, size_t len,
+                                                 size_t capacity) {
+  if (capacity >= len + simdjson::SIMDJSON_PADDING) {
+    return simdjson::padded_string_view(data, len, capacity);
+  }
+
+  thread_local std::vector<char> scratch(kParseScratchBytes +
+                                         simdjson::SIMDJSON_PADDING);
+  if (scratch.size() < len + simdjson::SIMDJSON_PADDING) {
+    scratch.resize(std::max(len, 2 * scratch.size()) +
+                   simdjson::SIMDJSON_PADDING);
+  }
+  std::memcpy(scratch.data(), data, len);
+  return simdjson::padded_string_view(scratch.data(), len, scratch.size());
+}
+
 /**
  * Parses a JSON message from Binance and extracts relevant fields
  * into the provided BookTicker struct.
  *
- * @param json_message A JSON message string from Binance.
+ * The symbol is looked up straight from the parsed std::string_view (see
+ * SymbolLookup), so a successful parse does not allocate.
+ *
  * @param parser simdjson ondemand parser used for efficient parsing.
- * @param book_ticker Reference to a BookTicker struct that will be populated
+ * @param json Padded view over a JSON message from Binance.
+ * @param bt Reference to a BookTicker struct that will be populated
  * with parsed data.
+ * @param set_recv_time If true, stamps `my_receive_time_ns` with the current
+ * time.
+ * @param symbol_lookup Optional symbol → ID/slot lookup; throws
+ * std::runtime_error if the symbol is not present.
  */
-
 inline bool parse_book_ticker(simdjson::ondemand::parser &parser,
-                              const std::string &s, BookTicker &bt,
-                              bool set_recv_time,
-                              const SymbolIdMap *symbol_lookup) {
-  simdjson::padded_string padded(s);
-  auto doc = parser.iterate(padded);
+                              simdjson::padded_string_view json,
+                              BookTicker &bt, bool set_recv_time,
+                              const SymbolLookup *symbol_lookup) {
+  auto doc = parser.iterate(json);
 
   // Extract the string views
   std::string_view bid_price_str = doc["b"].get_string().value();
@@ -54,21 +100,151 @@ inline bool parse_book_ticker(simdjson::ondemand::parser &parser,
   bt.update_id = doc["u"].get_int64().value();
 
   if (symbol_lookup) {
-    std::string symbol = std::string(doc["s"].get_string().value());
-    auto it = symbol_lookup->find(symbol);
-    if (it != symbol_lookup->end())
-      bt.id = it->second;
-    else {
-      throw std::runtime_error("ticker " + symbol + " no in lookup table");
+    std::string_view symbol = doc["s"].get_string().value();
+    SymbolRef ref = find_symbol(*symbol_lookup, symbol);
+    if (ref.id >= 0) {
+      bt.id = ref.id;
+      bt.slot = ref.slot;
+    } else {
+      throw std::runtime_error("ticker " + std::string(symbol) +
+                               " no in lookup table");
     }
   }
 
   bt.trade_time = doc["T"].get_int64().value();
   int64_t event_time = doc["E"].get_int64().value();
-  bt.event_time_ms_midnight = epoch_ms_to_midnight_ms_utc(event_time);
+  bt.event_time_ms_midnight = cached_midnight_ms_utc(event_time);
 
   if (set_recv_time) {
-    bt.my_receive_time_ns = now_ns_since_epoch();
+    bt.my_receive_time_ns = receive_time_ns();
   }
   return true;
 }
+
+/**
+ * @brief Raw-buffer entry point. Parses in place when @p capacity leaves room
+ * for simdjson padding, otherwise copies into the thread-local scratch buffer.
+ */
+inline bool parse_book_ticker(simdjson::ondemand::parser &parser,
+                              const char *data, size_t len, size_t capacity,
+                              BookTicker &bt, bool set_recv_time,
+                              const SymbolLookup *symbol_lookup) {
+  return parse_book_ticker(parser, padded_frame(data, len, capacity), bt,
+                           set_recv_time, symbol_lookup);
+}
+
+/// std::string_view entry point (always copies into the scratch buffer).
+inline bool parse_book_ticker(simdjson::ondemand::parser &parser,
+                              std::string_view s, BookTicker &bt,
+                              bool set_recv_time,
+                              const SymbolLookup *symbol_lookup) {
+  return parse_book_ticker(parser, s.data(), s.size(), s.size(), bt,
+                           set_recv_time, symbol_lookup);
+}
+
+/// std::string entry point; reuses the string's spare capacity as padding
+/// when there is enough of it.
+inline bool parse_book_ticker(simdjson::ondemand::parser &parser,
+                              const std::string &s, BookTicker &bt,
+                              bool set_recv_time,
+                              const SymbolLookup *symbol_lookup) {
+  return parse_book_ticker(parser, s.data(), s.size(), s.capacity(), bt,
+                           set_recv_time, symbol_lookup);
+}
+
+/// Maps a simdjson error from a field access onto a ParseStatus.
+inline ParseStatus to_parse_status(simdjson::error_code err) {
+  switch (err) {
+  case simdjson::NO_SUCH_FIELD:
+    return ParseStatus::MissingField;
+  case simdjson::NUMBER_ERROR:
+  case simdjson::NUMBER_OUT_OF_RANGE:
+  case simdjson::BIGINT_ERROR:
+    return ParseStatus::MalformedNumber;
+  default:
+    return ParseStatus::MalformedJson;
+  }
+}
+
+/// Converts a whole decimal string to double; false unless fully consumed.
+inline bool parse_price(std::string_view s, double &out) {
+  auto r = fast_float::from_chars(s.data(), s.data() + s.size(), out);
+  return r.ec == std::errc() && r.ptr == s.data() + s.size();
+}
+
+/**
+ * @brief Exception-free variant of parse_book_ticker.
+ *
+ * Uses simdjson's error-code API throughout and reports failures as a
+ * ParseStatus instead of throwing, so bad-frame bursts and the subscription
+ * ack never hit the unwinder. A frame with no `"b"` field but an `"id"` field
+ * (subscription results and errors) is reported as ParseStatus::ControlFrame.
+ *
+ * @return ParseStatus::Ok if @p bt was fully populated.
+ */
+inline ParseStatus parse_book_ticker_ec(simdjson::ondemand::parser &parser,
+                                        simdjson::padded_string_view json,
+                                        BookTicker &bt, bool set_recv_time,
+                                        const SymbolLookup *symbol_lookup) {
+  simdjson::ondemand::document doc;
+  simdjson::ondemand::object obj;
+  if (parser.iterate(json).get(doc) || doc.get_object().get(obj))
+    return ParseStatus::MalformedJson;
+
+  std::string_view bid_price_str, bid_qty_str, ask_price_str, ask_qty_str;
+  if (auto err = obj["b"].get_string().get(bid_price_str)) {
+    if (err == simdjson::NO_SUCH_FIELD &&
+        obj.find_field_unordered("id").error() == simdjson::SUCCESS)
+      return ParseStatus::ControlFrame;
+    return to_parse_status(err);
+  }
+  if (auto err = obj["B"].get_string().get(bid_qty_str))
+    return to_parse_status(err);
+  if (auto err = obj["a"].get_string().get(ask_price_str))
+    return to_parse_status(err);
+  if (auto err = obj["A"].get_string().get(ask_qty_str))
+    return to_parse_status(err);
+
+  if (!parse_price(bid_price_str, bt.bid_price) ||
+      !parse_price(bid_qty_str, bt.bid_qty) ||
+      !parse_price(ask_price_str, bt.ask_price) ||
+      !parse_price(ask_qty_str, bt.ask_qty))
+    return ParseStatus::MalformedNumber;
+
+  if (auto err = obj["u"].get_int64().get(bt.update_id))
+    return to_parse_status(err);
+
+  if (symbol_lookup) {
+    std::string_view symbol;
+    if (auto err = obj["s"].get_string().get(symbol))
+      return to_parse_status(err);
+    SymbolRef ref = find_symbol(*symbol_lookup, symbol);
+    if (ref.id < 0)
+      return ParseStatus::UnknownSymbol;
+    bt.id = ref.id;
+    bt.slot = ref.slot;
+  }
+
+  int64_t event_time;
+  if (auto err = obj["T"].get_int64().get(bt.trade_time))
+    return to_parse_status(err);
+  if (auto err = obj["E"].get_int64().get(event_time))
+    return to_parse_status(err);
+  bt.event_time_ms_midnight = cached_midnight_ms_utc(event_time);
+
+  if (set_recv_time) {
+    bt.my_receive_time_ns = receive_time_ns();
+  }
+  return ParseStatus::Ok;
+}
+
+/// std::string entry point for parse_book_ticker_ec; reuses the string's spare
+/// capacity as padding when there is enough of it.
+inline ParseStatus parse_book_ticker_ec(simdjson::ondemand::parser &parser,
+                                        const std::string &s, BookTicker &bt,
+                                        bool set_recv_time,
+                                        const SymbolLookup *symbol_lookup) {
+  return parse_book_ticker_ec(parser,
+                              padded_frame(s.data(), s.size(), s.capacity()),
+                              bt, set_recv_time, symbol_lookup);
+}
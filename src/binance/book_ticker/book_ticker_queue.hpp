@@ -1,6 +1,51 @@
 #pragma once
 
 #include "book_ticker.hpp"
+#include "common/conflating_buffer.hpp"
+#include "common/spsc_ring.hpp"
 #include <moodycamel/concurrentqueue.h>
+#include <string_view>
 
 using BookTickerQueue = moodycamel::ConcurrentQueue<BookTicker>;
+
+/// Bounded SPSC alternative for the one websocket thread → one consumer
+/// topology (64K slots × 64 bytes = 4 MiB; allocate on the heap).
+using SpscBookTickerQueue = SpscRing<BookTicker, 1 << 16>;
+
+/// Latest-quote-per-symbol alternative: one entry per symbol slot, bounded
+/// memory, never drops (sized at runtime from the symbol map).
+using ConflatingBookTickerBuffer = ConflatingBuffer<BookTicker>;
+
+/// Ticker type a hand-off queue carries: BookTicker, or FixedBookTicker for
+/// the `--prices fixed` queues (see fixed_book_ticker.hpp).
+template <typename Queue> struct queue_ticker {
+  using type = BookTicker;
+};
+
+template <typename Queue>
+using queue_ticker_t = typename queue_ticker<Queue>::type;
+
+/// Selects the websocket → consumer hand-off queue at runtime.
+enum class QueueKind {
+  Moodycamel, ///< BookTickerQueue (unbounded MPMC)
+  Spsc,       ///< SpscBookTickerQueue (bounded SPSC ring)
+  Conflate    ///< ConflatingBookTickerBuffer (latest value per symbol)
+};
+
+/**
+ * @brief Parses a QueueKind from its CLI name ("moodycamel", "spsc" or
+ * "conflate").
+ * @return false if the name is not recognised.
+ */
+inline bool parse_queue_kind(std::string_view name, QueueKind &kind) {
+  if (name == "moodycamel") {
+    kind = QueueKind::Moodycamel;
+  } else if (name == "spsc") {
+    kind = QueueKind::Spsc;
+  } else if (name == "conflate") {
+    kind = QueueKind::Conflate;
+  } else {
+    return false;
+  }
+  return true;
+}
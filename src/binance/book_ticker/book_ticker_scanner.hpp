@@ -0,0 +1,202 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "book_ticker_parser.hpp"
+#include "common/time_utils.hpp"
+#include "parse_status.hpp"
+#include "symbol_lookup_table.hpp"
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <fast_float/fast_float.h>
+#include <simdjson.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Single-pass scanner for Binance Futures `bookTicker` frames.
+ *
+ * Binance always emits the futures bookTicker keys in the same order:
+ *
+ *   {"e":"bookTicker","u":<int>,"s":"<sym>","b":"<px>","B":"<qty>",
+ *    "a":"<px>","A":"<qty>","T":<int>,"E":<int>}
+ *
+ * Instead of looking every key up by name, the scanner walks the frame once,
+ * checking each fixed key literal with a short memcmp (lowered to one or two
+ * wide loads) and handing the values straight to from_chars / fast_float,
+ * which stop at the closing quote or comma. The symbol is found with memchr
+ * (vectorised in libc). Any deviation from the layout — whitespace, reordered
+ * or missing keys, control frames such as `{"result":null,"id":1}` — makes the
+ * scanner report a mismatch so the caller can fall back to simdjson.
+ */
+namespace book_ticker_scan {
+
+inline bool expect(const char *&p, const char *end, std::string_view lit) {
+  if (static_cast<size_t>(end - p) < lit.size() ||
+      std::memcmp(p, lit.data(), lit.size()) != 0)
+    return false;
+  p += lit.size();
+  return true;
+}
+
+inline bool scan_int(const char *&p, const char *end, int64_t &out) {
+  auto r = std::from_chars(p, end, out);
+  if (r.ec != std::errc())
+    return false;
+  p = r.ptr;
+  return true;
+}
+
+/// Parses a quoted decimal; @p p must point just past the opening quote and is
+/// left just past the closing quote.
+inline bool scan_quoted_double(const char *&p, const char *end, double &out) {
+  auto r = fast_float::from_chars(p, end, out);
+  if (r.ec != std::errc() || r.ptr == end || *r.ptr != '"')
+    return false;
+  p = r.ptr + 1;
+  return true;
+}
+
+inline bool scan_quoted_string(const char *&p, const char *end,
+                               std::string_view &out) {
+  const char *q =
+      static_cast<const char *>(std::memchr(p, '"', static_cast<size_t>(end - p)));
+  if (!q)
+    return false;
+  out = std::string_view(p, static_cast<size_t>(q - p));
+  p = q + 1;
+  return true;
+}
+
+} // namespace book_ticker_scan
+
+/**
+ * @brief Scans a bookTicker frame assuming the fixed Binance Futures layout,
+ * without throwing.
+ *
+ * @param s Raw JSON frame.
+ * @param bt BookTicker populated on success (may be partially written on a
+ * mismatch).
+ * @param set_recv_time If true, stamps `my_receive_time_ns`.
+ * @param symbol_lookup Optional symbol → ID/slot lookup.
+ * @param status Set to ParseStatus::Ok or ParseStatus::UnknownSymbol when the
+ * layout matched; untouched otherwise.
+ * @return true if the frame matched the layout, false if it did not and
+ * should be handed to the generic parser.
+ */
+inline bool scan_book_ticker(std::string_view s, BookTicker &bt,
+                             bool set_recv_time,
+                             const SymbolLookup *symbol_lookup,
+                             ParseStatus &status) {
+  using namespace book_ticker_scan;
+  const char *p = s.data();
+  const char *end = p + s.size();
+  std::string_view symbol;
+  int64_t event_time;
+
+  bool ok = expect(p, end, R"({"e":"bookTicker","u":)") &&
+            scan_int(p, end, bt.update_id) && expect(p, end, R"(,"s":")") &&
+            scan_quoted_string(p, end, symbol) &&
+            expect(p, end, R"(,"b":")") &&
+            scan_quoted_double(p, end, bt.bid_price) &&
+            expect(p, end, R"(,"B":")") &&
+            scan_quoted_double(p, end, bt.bid_qty) &&
+            expect(p, end, R"(,"a":")") &&
+            scan_quoted_double(p, end, bt.ask_price) &&
+            expect(p, end, R"(,"A":")") &&
+            scan_quoted_double(p, end, bt.ask_qty) &&
+            expect(p, end, R"(,"T":)") && scan_int(p, end, bt.trade_time) &&
+            expect(p, end, R"(,"E":)") && scan_int(p, end, event_time) &&
+            expect(p, end, "}");
+  if (!ok)
+    return false;
+
+  if (symbol_lookup) {
+    SymbolRef ref = find_symbol(*symbol_lookup, symbol);
+    if (ref.id < 0) {
+      status = ParseStatus::UnknownSymbol;
+      return true;
+    }
+    bt.id = ref.id;
+    bt.slot = ref.slot;
+  }
+
+  bt.event_time_ms_midnight = cached_midnight_ms_utc(event_time);
+  if (set_recv_time) {
+    bt.my_receive_time_ns = receive_time_ns();
+  }
+  status = ParseStatus::Ok;
+  return true;
+}
+
+/**
+ * @brief Throwing form of scan_book_ticker (same contract as
+ * parse_book_ticker): unknown symbols raise std::runtime_error.
+ */
+inline bool scan_book_ticker(std::string_view s, BookTicker &bt,
+                             bool set_recv_time,
+                             const SymbolLookup *symbol_lookup) {
+  ParseStatus status;
+  if (!scan_book_ticker(s, bt, set_recv_time, symbol_lookup, status))
+    return false;
+  if (status == ParseStatus::UnknownSymbol) {
+    throw std::runtime_error("ticker unknown symbol, not in lookup table");
+  }
+  return true;
+}
+
+/// Selects the bookTicker parsing strategy at runtime.
+enum class ParserKind {
+  Simdjson, ///< Generic simdjson on-demand lookups by key
+  Fixed     ///< Fixed-layout scanner with simdjson fallback
+};
+
+/**
+ * @brief Parses a ParserKind from its CLI name ("simdjson" or "fixed").
+ * @return false if the name is not recognised.
+ */
+inline bool parse_parser_kind(std::string_view name, ParserKind &kind) {
+  if (name == "simdjson") {
+    kind = ParserKind::Simdjson;
+  } else if (name == "fixed") {
+    kind = ParserKind::Fixed;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Parses a frame with the requested strategy. ParserKind::Fixed tries
+ * scan_book_ticker first and falls back to the simdjson path when the layout
+ * does not match.
+ */
+inline bool parse_book_ticker(ParserKind kind,
+                              simdjson::ondemand::parser &parser,
+                              const std::string &s, BookTicker &bt,
+                              bool set_recv_time,
+                              const SymbolLookup *symbol_lookup) {
+  if (kind == ParserKind::Fixed &&
+      scan_book_ticker(s, bt, set_recv_time, symbol_lookup)) {
+    return true;
+  }
+  return parse_book_ticker(parser, s, bt, set_recv_time, symbol_lookup);
+}
+
+/**
+ * @brief Exception-free parse with the requested strategy; see
+ * parse_book_ticker_ec.
+ */
+inline ParseStatus parse_book_ticker_ec(ParserKind kind,
+                                        simdjson::ondemand::parser &parser,
+                                        const std::string &s, BookTicker &bt,
+                                        bool set_recv_time,
+                                        const SymbolLookup *symbol_lookup) {
+  ParseStatus status;
+  if (kind == ParserKind::Fixed &&
+      scan_book_ticker(s, bt, set_recv_time, symbol_lookup, status)) {
+    return status;
+  }
+  return parse_book_ticker_ec(parser, s, bt, set_recv_time, symbol_lookup);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "common/shm_broadcast_ring.hpp"
+#include "common/shm_seqlock_table.hpp"
+#include <cstdint>
+
+/// Shared-memory broadcast of BookTickers to same-host consumers
+/// (`--shm` in binance_main and consumer_main).
+using BookTickerShmWriter = ShmBroadcastWriter<BookTicker>;
+using BookTickerShmReader = ShmBroadcastReader<BookTicker>;
+
+/// Default shm object name (/dev/shm/binance_bookticker)
+inline constexpr const char *kDefaultBookTickerShm = "/binance_bookticker";
+
+/// Ring slots (128 bytes each incl. sequence word → 8 MiB); a reader may fall
+/// this many tickers behind before it is overrun.
+inline constexpr uint64_t kBookTickerShmSlots = 1 << 16;
+
+/// Latest BookTicker per symbol ID in shared memory (`--quotes` in
+/// binance_main and consumer_main).
+using QuoteTableWriter = ShmSeqlockTableWriter<BookTicker>;
+using QuoteTableReader = ShmSeqlockTableReader<BookTicker>;
+
+/// Default shm object name (/dev/shm/binance_quotes)
+inline constexpr const char *kDefaultQuoteTableShm = "/binance_quotes";
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "book_ticker_batch.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <zmq.hpp>
+
+/**
+ * @brief Per-symbol ZMQ topics.
+ *
+ * Every published message is two frames:
+ *
+ *   [ topic: symbol ID, 4 raw bytes ][ payload: BookTicker or batch frame ]
+ *
+ * All topics have the same width, so a SUB socket subscribed to
+ * book_ticker_topic(id) matches exactly that symbol and libzmq drops the rest
+ * on the publisher side before they reach the network.
+ */
+inline constexpr size_t kBookTickerTopicBytes = sizeof(int32_t);
+
+/// Subscription / topic frame bytes for symbol @p id.
+inline std::string book_ticker_topic(int32_t id) {
+  std::string topic(kBookTickerTopicBytes, '\0');
+  std::memcpy(topic.data(), &id, kBookTickerTopicBytes);
+  return topic;
+}
+
+/**
+ * @class BookTickerTopicPublisher
+ * @brief Publishes drained tickers as one [topic | payload] message per
+ * symbol present in the batch.
+ *
+ * Tickers of one symbol keep their arrival order; order across symbols is
+ * not preserved within a batch. A symbol with a single ticker is sent as a
+ * plain 64-byte frame, several as a batch frame. Scratch buffers are sized
+ * once, so publishing does not allocate beyond the ZMQ messages themselves.
+ */
+class BookTickerTopicPublisher {
+public:
+  BookTickerTopicPublisher(zmq::socket_t &socket, size_t max_batch)
+      : socket_(socket), grouped_(max_batch), taken_(max_batch) {}
+
+  /// Sends @p count tickers (at most max_batch); returns messages sent.
+  size_t publish(const BookTicker *tickers, size_t count) {
+    std::fill(taken_.begin(), taken_.begin() + count, 0);
+    size_t out = 0;
+    size_t messages = 0;
+    for (size_t i = 0; i < count; ++i) {
+      if (taken_[i])
+        continue;
+      const int32_t id = tickers[i].id;
+      const size_t begin = out;
+      for (size_t j = i; j < count; ++j) {
+        if (!taken_[j] && tickers[j].id == id) {
+          grouped_[out++] = tickers[j];
+          taken_[j] = 1;
+        }
+      }
+      send(id, &grouped_[begin], out - begin);
+      ++messages;
+    }
+    return messages;
+  }
+
+private:
+  zmq::socket_t &socket_;
+  std::vector<BookTicker> grouped_;
+  std::vector<uint8_t> taken_;
+
+  void send(int32_t id, const BookTicker *tickers, size_t count) {
+    zmq::message_t topic(kBookTickerTopicBytes);
+    std::memcpy(topic.data(), &id, kBookTickerTopicBytes);
+    socket_.send(topic, zmq::send_flags::sndmore);
+    if (count == 1) {
+      zmq::message_t payload(sizeof(BookTicker));
+      std::memcpy(payload.data(), tickers, sizeof(BookTicker));
+      socket_.send(payload, zmq::send_flags::none);
+    } else {
+      socket_.send(encode_book_ticker_batch(tickers, count),
+                   zmq::send_flags::none);
+    }
+  }
+};
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// What counts as a top-of-book change worth publishing.
+enum class ChangePolicy {
+  Off,   ///< Publish every update
+  Any,   ///< Any of bid/ask price/qty changed (u/T/E alone do not count)
+  Price, ///< Bid or ask price changed
+  Qty    ///< Price changed, or a qty moved by more than the threshold
+};
+
+/// What to do with an update the policy rejects.
+enum class ChangeAction {
+  Drop, ///< Do not publish it
+  Flag  ///< Publish it anyway, only count it (dry run)
+};
+
+/**
+ * @struct ChangeFilterConfig
+ * @brief Change filter settings (`--filter`).
+ */
+struct ChangeFilterConfig {
+  ChangePolicy policy = ChangePolicy::Off;
+  ChangeAction action = ChangeAction::Drop;
+
+  /// Relative qty change that passes ChangePolicy::Qty (0.05 = 5%)
+  double qty_threshold = 0.0;
+};
+
+/**
+ * @brief Parses `off`, `any`, `price` or `qty[:threshold]`, optionally
+ * followed by `,flag` (e.g. "qty:0.1,flag").
+ * @return false if the spec is malformed.
+ */
+inline bool parse_change_filter(std::string_view spec,
+                                ChangeFilterConfig &cfg) {
+  ChangeFilterConfig out;
+  if (size_t comma = spec.find(','); comma != std::string_view::npos) {
+    if (spec.substr(comma + 1) != "flag")
+      return false;
+    out.action = ChangeAction::Flag;
+    spec = spec.substr(0, comma);
+  }
+  std::string_view name = spec.substr(0, spec.find(':'));
+  if (name == "off") {
+    out.policy = ChangePolicy::Off;
+  } else if (name == "any") {
+    out.policy = ChangePolicy::Any;
+  } else if (name == "price") {
+    out.policy = ChangePolicy::Price;
+  } else if (name == "qty") {
+    out.policy = ChangePolicy::Qty;
+  } else {
+    return false;
+  }
+  if (name.size() < spec.size()) {
+    if (out.policy != ChangePolicy::Qty)
+      return false;
+    std::string value(spec.substr(name.size() + 1));
+    char *end = nullptr;
+    out.qty_threshold = std::strtod(value.c_str(), &end);
+    if (value.empty() || *end != '\0' || out.qty_threshold < 0)
+      return false;
+  }
+  cfg = out;
+  return true;
+}
+
+/**
+ * @class BasicChangeFilter
+ * @brief Suppresses bookTicker updates that do not change the top of book
+ * enough to matter, per ChangeFilterConfig.
+ *
+ * Keeps the last published ticker per symbol slot (BookTicker::slot) and
+ * per-symbol seen / suppressed counters in flat arrays. Not thread-safe: runs
+ * on the consumer thread.
+ *
+ * @tparam Ticker BookTicker, or FixedBookTicker (`--prices fixed`), whose
+ * integer ticks and lots make every comparison an exact integer compare.
+ */
+template <typename Ticker> class BasicChangeFilter {
+public:
+  /// @param symbols Number of symbol slots (see symbol_slot_count).
+  BasicChangeFilter(const ChangeFilterConfig &cfg, size_t symbols)
+      : cfg_(cfg), last_(symbols), has_last_(symbols, 0), seen_(symbols, 0),
+        suppressed_(symbols, 0) {}
+
+  bool enabled() const { return cfg_.policy != ChangePolicy::Off; }
+
+  /**
+   * @brief Decides whether @p bt should be published, and remembers it as
+   * the symbol's last published state if so.
+   *
+   * The first update of a symbol and slots out of range always pass.
+   */
+  bool accept(const Ticker &bt) {
+    const size_t slot = bt.slot;
+    if (!enabled() || slot >= last_.size())
+      return true;
+    ++seen_[slot];
+    if (has_last_[slot] && !changed(last_[slot], bt)) {
+      ++suppressed_[slot];
+      if (cfg_.action == ChangeAction::Drop)
+        return false;
+    }
+    last_[slot] = bt;
+    has_last_[slot] = 1;
+    return true;
+  }
+
+  /**
+   * @brief Removes rejected tickers from [@p tickers, @p tickers + @p count)
+   * in place, keeping order.
+   * @return number of tickers kept.
+   */
+  size_t filter(Ticker *tickers, size_t count) {
+    if (!enabled())
+      return count;
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+      if (accept(tickers[i])) {
+        if (kept != i)
+          tickers[kept] = tickers[i];
+        ++kept;
+      }
+    }
+    return kept;
+  }
+
+  uint64_t seen(size_t slot) const { return at(seen_, slot); }
+  uint64_t suppressed(size_t slot) const { return at(suppressed_, slot); }
+
+  /**
+   * @brief Prints the suppression rate of every symbol seen so far.
+   * @param symbol_of Callable mapping a slot to a printable symbol name.
+   */
+  template <typename SymbolOf>
+  void print(std::ostream &os, SymbolOf &&symbol_of) const {
+    uint64_t seen_total = 0, suppressed_total = 0;
+    for (size_t slot = 0; slot < seen_.size(); ++slot) {
+      seen_total += seen_[slot];
+      suppressed_total += suppressed_[slot];
+    }
+    os << (cfg_.action == ChangeAction::Flag ? "change filter (flag only):"
+                                             : "change filter:")
+       << " suppressed " << suppressed_total << '/' << seen_total << " ("
+       << percent(suppressed_total, seen_total) << "%)\n";
+    for (size_t slot = 0; slot < seen_.size(); ++slot) {
+      if (seen_[slot])
+        os << "  " << symbol_of(slot) << ' ' << suppressed_[slot] << '/'
+           << seen_[slot] << " (" << percent(suppressed_[slot], seen_[slot])
+           << "%)\n";
+    }
+  }
+
+  /// Clears the counters (last published state is kept).
+  void reset_counters() {
+    std::fill(seen_.begin(), seen_.end(), 0);
+    std::fill(suppressed_.begin(), suppressed_.end(), 0);
+  }
+
+private:
+  ChangeFilterConfig cfg_;
+  std::vector<Ticker> last_;
+  std::vector<uint8_t> has_last_;
+  std::vector<uint64_t> seen_;
+  std::vector<uint64_t> suppressed_;
+
+  template <typename Qty> bool qty_moved(Qty prev, Qty next) const {
+    if (prev == next)
+      return false;
+    if (prev == 0)
+      return true;
+    const Qty diff = next > prev ? next - prev : prev - next;
+    const Qty base = prev < 0 ? -prev : prev;
+    return static_cast<double>(diff) >
+           cfg_.qty_threshold * static_cast<double>(base);
+  }
+
+  bool changed(const Ticker &prev, const Ticker &next) const {
+    const bool price = prev.bid_price != next.bid_price ||
+                       prev.ask_price != next.ask_price;
+    switch (cfg_.policy) {
+    case ChangePolicy::Off:
+      return true;
+    case ChangePolicy::Any:
+      return !same_top_of_book(prev, next);
+    case ChangePolicy::Price:
+      return price;
+    case ChangePolicy::Qty:
+      return price || qty_moved(prev.bid_qty, next.bid_qty) ||
+             qty_moved(prev.ask_qty, next.ask_qty);
+    }
+    return true;
+  }
+
+  static uint64_t at(const std::vector<uint64_t> &v, size_t slot) {
+    return slot < v.size() ? v[slot] : 0;
+  }
+
+  static double percent(uint64_t part, uint64_t whole) {
+    return whole ? 100.0 * static_cast<double>(part) / whole : 0.0;
+  }
+};
+
+using BookTickerChangeFilter = BasicChangeFilter<BookTicker>;
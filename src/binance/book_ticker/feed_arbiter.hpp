@@ -0,0 +1,218 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "common/latency_histogram.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class FeedArbiter
+ * @brief De-duplicates redundant A/B/... feeds of the same bookTicker stream
+ * on (symbol id, update_id).
+ *
+ * Binance's `u` is monotonic per symbol, so an update newer than the last
+ * published one for its symbol slot (BookTicker::slot) is the first arrival
+ * and is published; anything else is discarded. To tell a late copy of an
+ * older update (the other leg was faster by more than one update of that
+ * symbol) from an update that was never published, each slot remembers its
+ * last @p depth published updates in a small ring: a discarded `u` found
+ * there is a duplicate, one that is not is stale.
+ *
+ * Wins are credited by receive timestamp rather than by which copy was
+ * processed first, since the merge order of the legs is not the arrival
+ * order. When an update first shows up on a second leg, the winner's
+ * advantage (loser receive time − winner receive time) is recorded per leg.
+ *
+ * Not thread-safe: runs on the merging consumer thread.
+ */
+class FeedArbiter {
+public:
+  /// Published updates remembered per symbol by default.
+  static constexpr size_t kDefaultDepth = 64;
+
+  FeedArbiter(size_t legs, size_t symbols, size_t depth = kDefaultDepth)
+      : legs_(legs), depth_(depth ? depth : 1), head_(symbols, 0),
+        recent_(symbols * depth_) {}
+
+  size_t legs() const { return legs_.size(); }
+
+  /**
+   * @brief Decides whether @p bt, received on @p leg, is the first arrival of
+   * its update.
+   *
+   * Slots out of range always pass and are not tracked.
+   */
+  bool accept(size_t leg, const BookTicker &bt) {
+    const size_t slot = bt.slot;
+    if (slot >= head_.size())
+      return true;
+    Published *ring = &recent_[slot * depth_];
+    uint32_t &head = head_[slot];
+    if (bt.update_id > ring[head].update_id) {
+      head = static_cast<uint32_t>(head + 1 == depth_ ? 0 : head + 1);
+      ring[head] = {bt.update_id, bt.my_receive_time_ns,
+                    static_cast<uint32_t>(leg), false};
+      ++legs_[leg].won;
+      return true;
+    }
+    Published *p = find(ring, head, bt.update_id);
+    if (!p) {
+      ++legs_[leg].stale;
+      return false;
+    }
+    ++legs_[leg].duplicate;
+    if (leg == p->winner)
+      return false;
+    if (bt.my_receive_time_ns < p->recv_ns) {
+      // This copy arrived first but was merged later: move the win
+      if (!p->raced)
+        legs_[leg].advantage.record(p->recv_ns - bt.my_receive_time_ns);
+      // (guarded: counters may have been reset in between)
+      if (legs_[p->winner].won)
+        --legs_[p->winner].won;
+      ++legs_[p->winner].duplicate;
+      --legs_[leg].duplicate;
+      ++legs_[leg].won;
+      p->winner = static_cast<uint32_t>(leg);
+      p->recv_ns = bt.my_receive_time_ns;
+    } else if (!p->raced) {
+      legs_[p->winner].advantage.record(bt.my_receive_time_ns - p->recv_ns);
+    }
+    p->raced = true;
+    return false;
+  }
+
+  uint64_t won(size_t leg) const { return legs_[leg].won; }
+  uint64_t duplicate(size_t leg) const { return legs_[leg].duplicate; }
+  uint64_t stale(size_t leg) const { return legs_[leg].stale; }
+
+  /// Prints per-leg wins, duplicates and latency advantage.
+  void print(std::ostream &os) const {
+    uint64_t total = 0;
+    for (const LegStats &l : legs_)
+      total += l.won;
+    for (size_t k = 0; k < legs_.size(); ++k) {
+      const LegStats &l = legs_[k];
+      os << "leg " << k << ": won " << l.won << " ("
+         << (total ? 100.0 * static_cast<double>(l.won) / total : 0.0)
+         << "%) duplicate " << l.duplicate << " stale " << l.stale << ' ';
+      l.advantage.print(os, "advantage when first");
+    }
+  }
+
+  /// Clears the counters (per-symbol state is kept).
+  void reset_counters() {
+    for (LegStats &l : legs_)
+      l = LegStats{};
+  }
+
+private:
+  struct Published {
+    int64_t update_id = 0; ///< Published `u` (0 = empty)
+    int64_t recv_ns = 0;   ///< Receive time of its first arrival
+    uint32_t winner = 0;   ///< Leg that delivered it first
+    bool raced = false;    ///< A copy from another leg was already seen
+  };
+
+  struct LegStats {
+    uint64_t won = 0;
+    uint64_t duplicate = 0;
+    uint64_t stale = 0;
+    LatencyHistogram advantage;
+  };
+
+  /// Walks a slot's ring from the newest entry back; late copies are
+  /// usually only a few updates behind. Null if @p u is not remembered.
+  Published *find(Published *ring, uint32_t head, int64_t u) const {
+    size_t i = head;
+    for (size_t n = 0; n < depth_; ++n) {
+      if (ring[i].update_id <= u)
+        return ring[i].update_id == u ? &ring[i] : nullptr;
+      i = i ? i - 1 : depth_ - 1;
+    }
+    return nullptr;
+  }
+
+  std::vector<LegStats> legs_;
+  size_t depth_;
+  std::vector<uint32_t> head_;    ///< Ring index of each slot's newest entry
+  std::vector<Published> recent_; ///< depth_ entries per slot
+};
+
+/**
+ * @class ArbitratedBookTickerQueue
+ * @brief Merges K redundant legs (one SPSC ring per websocket connection)
+ * through a FeedArbiter behind the usual consumer queue API.
+ *
+ * Only the first arrival of each update is returned by try_dequeue /
+ * try_dequeue_bulk; duplicates are consumed and dropped. Legs are drained
+ * round-robin, one ticker at a time, so a leg that is ahead gets its copy
+ * published first.
+ */
+class ArbitratedBookTickerQueue {
+public:
+  /// @param symbols Number of symbol slots (see symbol_slot_count).
+  /// @param depth Published updates remembered per symbol (see FeedArbiter).
+  ArbitratedBookTickerQueue(size_t legs, size_t symbols,
+                            size_t depth = FeedArbiter::kDefaultDepth)
+      : legs_(legs), arbiter_(legs, symbols, depth) {
+    for (auto &ring : legs_)
+      ring = std::make_unique<SpscBookTickerQueue>();
+  }
+
+  size_t legs() const { return legs_.size(); }
+
+  /// Producer side of leg @p k (one websocket thread).
+  SpscBookTickerQueue &leg(size_t k) { return *legs_[k]; }
+
+  const FeedArbiter &arbiter() const { return arbiter_; }
+
+  bool try_dequeue(BookTicker &out) { return try_dequeue_bulk(&out, 1) == 1; }
+
+  template <typename It> size_t try_dequeue_bulk(It out, size_t max) {
+    const size_t k = legs_.size();
+    size_t n = 0;
+    BookTicker bt;
+    bool progress = true;
+    while (n < max && progress) {
+      progress = false;
+      for (size_t i = 0; i < k && n < max; ++i) {
+        const size_t leg = (next_ + i) % k;
+        if (!legs_[leg]->try_dequeue(bt))
+          continue;
+        progress = true;
+        if (arbiter_.accept(leg, bt)) {
+          *out = bt;
+          ++out;
+          ++n;
+        }
+      }
+      next_ = (next_ + 1) % k;
+    }
+    return n;
+  }
+
+  /// Tickers waiting on all legs (duplicates included).
+  size_t size_approx() const {
+    size_t n = 0;
+    for (const auto &ring : legs_)
+      n += ring->size_approx();
+    return n;
+  }
+
+  /// Prints per-leg arbitration counters, then resets them.
+  void print(std::ostream &os) {
+    arbiter_.print(os);
+    arbiter_.reset_counters();
+  }
+
+private:
+  std::vector<std::unique_ptr<SpscBookTickerQueue>> legs_;
+  FeedArbiter arbiter_;
+  size_t next_ = 0;
+};
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "book_ticker_parser.hpp"
+#include "book_ticker_queue.hpp"
+#include "book_ticker_scanner.hpp"
+#include "common/fixed_point.hpp"
+#include "common/time_utils.hpp"
+#include "parse_status.hpp"
+#include "symbol_lookup_table.hpp"
+#include <cstdint>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <simdjson.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @struct FixedBookTicker
+ * @brief Fixed-point counterpart of BookTicker.
+ *
+ * Prices are stored as integer ticks and quantities as integer lots, each
+ * scaled by the per-symbol number of decimals from SymbolScale. This gives
+ * exact equality tests and integer compares in downstream bar and change
+ * detection logic. Field order and size mirror BookTicker (64 bytes).
+ */
+struct alignas(64) FixedBookTicker {
+  /// Best bid price in ticks ("b" × 10^price_decimals)
+  int64_t bid_price;
+
+  /// Best bid quantity in lots ("B" × 10^qty_decimals)
+  int64_t bid_qty;
+
+  /// Best ask price in ticks ("a" × 10^price_decimals)
+  int64_t ask_price;
+
+  /// Best ask quantity in lots ("A" × 10^qty_decimals)
+  int64_t ask_qty;
+
+  /// Binance update ID ("u")
+  int64_t update_id;
+
+  /// Trade time as reported by Binance ("T")
+  int64_t trade_time;
+
+  /// Event time ("E") converted to ms from UTC midnight
+  int32_t event_time_ms_midnight;
+
+  /// Global symbol ID from the symbol file (e.g., 290 = BTCUSDT); what goes
+  /// on the wire and into ZMQ topics
+  int16_t id;
+
+  /// Dense per-stream index 0..N-1 of the subscribed symbol (see
+  /// SymbolSlotMap), for array-indexed per-symbol state in the hot path
+  uint16_t slot;
+
+  /// Receive time in nanoseconds from epoch
+  int64_t my_receive_time_ns;
+};
+
+static_assert(sizeof(FixedBookTicker) == 64,
+              "FixedBookTicker must be 64 bytes");
+static_assert(std::is_trivially_copyable<FixedBookTicker>::value,
+              "FixedBookTicker must be trivially copyable");
+
+/**
+ * @struct SymbolScale
+ * @brief Number of implied decimals for a symbol's prices and quantities.
+ *
+ * The default of 8/8 can represent any Binance price or quantity (their tick
+ * and step sizes are never finer than 1e-8) below 1e10: parse_fixed_decimal
+ * accepts at most kMaxFixedDecimals (18) digits in all.
+ */
+struct SymbolScale {
+  int8_t price_decimals = 8;
+  int8_t qty_decimals = 8;
+};
+
+/// Per-symbol scales indexed by symbol ID; IDs past the end use the default.
+class SymbolScaleTable {
+public:
+  const SymbolScale &operator[](int32_t id) const {
+    return (id >= 0 && static_cast<size_t>(id) < scales_.size()) ? scales_[id]
+                                                                  : default_;
+  }
+
+  void set(int32_t id, SymbolScale scale) {
+    if (static_cast<size_t>(id) >= scales_.size())
+      scales_.resize(static_cast<size_t>(id) + 1);
+    scales_[id] = scale;
+  }
+
+private:
+  std::vector<SymbolScale> scales_;
+  SymbolScale default_;
+};
+
+/**
+ * @brief Loads per-symbol decimal scales written by generate_symbol_files.py.
+ *
+ * Expected input JSON format:
+ * {
+ *   "btcusdt": { "price_decimals": 2, "qty_decimals": 3 },
+ *   ...
+ * }
+ *
+ * @param filename Path to the scales JSON file.
+ * @param symbol_map Symbol → ID map used to index the table (keys are
+ * matched case-insensitively).
+ * @throws std::runtime_error if the file cannot be opened or is malformed.
+ */
+inline SymbolScaleTable load_symbol_scales(const std::string &filename,
+                                           const SymbolIdMap &symbol_map) {
+  std::ifstream in_file(filename);
+  if (!in_file) {
+    throw std::runtime_error("❌ Failed to open file: " + filename);
+  }
+
+  nlohmann::json j;
+  in_file >> j;
+  if (!j.is_object()) {
+    throw std::runtime_error("❌ JSON root must be an object.");
+  }
+
+  SymbolScaleTable table;
+  for (const auto &[symbol, value] : j.items()) {
+    auto it = symbol_map.find(symbol);
+    if (it == symbol_map.end())
+      it = symbol_map.find(to_upper(symbol));
+    if (it == symbol_map.end())
+      continue;
+
+    SymbolScale scale;
+    scale.price_decimals = value.at("price_decimals").get<int8_t>();
+    scale.qty_decimals = value.at("qty_decimals").get<int8_t>();
+    if (scale.price_decimals < 0 || scale.price_decimals > kMaxFixedDecimals ||
+        scale.qty_decimals < 0 || scale.qty_decimals > kMaxFixedDecimals) {
+      throw std::runtime_error("❌ Invalid scale for symbol: " + symbol);
+    }
+    table.set(it->second, scale);
+  }
+  return table;
+}
+
+/// Converts a FixedBookTicker back to the floating-point wire format.
+inline BookTicker to_book_ticker(const FixedBookTicker &fx,
+                                 const SymbolScale &scale) {
+  BookTicker bt;
+  bt.bid_price = fixed_to_double(fx.bid_price, scale.price_decimals);
+  bt.bid_qty = fixed_to_double(fx.bid_qty, scale.qty_decimals);
+  bt.ask_price = fixed_to_double(fx.ask_price, scale.price_decimals);
+  bt.ask_qty = fixed_to_double(fx.ask_qty, scale.qty_decimals);
+  bt.update_id = fx.update_id;
+  bt.trade_time = fx.trade_time;
+  bt.event_time_ms_midnight = fx.event_time_ms_midnight;
+  bt.id = fx.id;
+  bt.slot = fx.slot;
+  bt.my_receive_time_ns = fx.my_receive_time_ns;
+  return bt;
+}
+
+/// Exact top-of-book comparison (prices and quantities only).
+inline bool same_top_of_book(const FixedBookTicker &a,
+                             const FixedBookTicker &b) {
+  return a.bid_price == b.bid_price && a.ask_price == b.ask_price &&
+         a.bid_qty == b.bid_qty && a.ask_qty == b.ask_qty;
+}
+
+/// Representation of prices and quantities between the websocket and the
+/// publish step (`--prices`).
+enum class PriceMode {
+  Double, ///< BookTicker end to end
+  Fixed   ///< FixedBookTicker until publishing, then to_book_ticker
+};
+
+/**
+ * @brief Parses a PriceMode from its CLI name ("double" or "fixed").
+ * @return false if the name is not recognised.
+ */
+inline bool parse_price_mode(std::string_view name, PriceMode &mode) {
+  if (name == "double") {
+    mode = PriceMode::Double;
+  } else if (name == "fixed") {
+    mode = PriceMode::Fixed;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/// Fixed-point counterparts of the hand-off queues (see book_ticker_queue.hpp).
+using FixedBookTickerQueue = moodycamel::ConcurrentQueue<FixedBookTicker>;
+using SpscFixedBookTickerQueue = SpscRing<FixedBookTicker, 1 << 16>;
+using ConflatingFixedBookTickerBuffer = ConflatingBuffer<FixedBookTicker>;
+
+template <> struct queue_ticker<FixedBookTickerQueue> {
+  using type = FixedBookTicker;
+};
+template <> struct queue_ticker<SpscFixedBookTickerQueue> {
+  using type = FixedBookTicker;
+};
+template <> struct queue_ticker<ConflatingFixedBookTickerBuffer> {
+  using type = FixedBookTicker;
+};
+
+namespace book_ticker_scan {
+
+/// Parses a quoted decimal into fixed point; @p p must point just past the
+/// opening quote and is left just past the closing quote.
+inline bool scan_quoted_fixed(const char *&p, const char *end, int decimals,
+                              int64_t &out) {
+  const char *q = parse_fixed_decimal(p, end, decimals, out);
+  if (!q || q == end || *q != '"')
+    return false;
+  p = q + 1;
+  return true;
+}
+
+inline bool parse_fixed_string(std::string_view s, int decimals,
+                               int64_t &out) {
+  const char *end = s.data() + s.size();
+  return parse_fixed_decimal(s.data(), end, decimals, out) == end;
+}
+
+} // namespace book_ticker_scan
+
+/**
+ * @brief Parses a bookTicker frame straight into fixed point, without
+ * throwing (see parse_book_ticker_ec).
+ *
+ * Tries the fixed-layout scanner first (the symbol precedes the prices, so
+ * the per-symbol scale is known before they are parsed) and falls back to
+ * simdjson key lookups when the layout does not match.
+ *
+ * @param parser simdjson parser used for the fallback path.
+ * @param s Raw JSON frame.
+ * @param fx Output ticker.
+ * @param set_recv_time If true, stamps `my_receive_time_ns`.
+ * @param symbol_lookup Optional symbol → ID/slot lookup. Without it every
+ * symbol uses the default scale.
+ * @param scales Per-symbol decimal scales.
+ * @return ParseStatus::MalformedNumber if a number cannot be represented at
+ * the symbol's scale; otherwise as parse_book_ticker_ec.
+ */
+inline ParseStatus parse_book_ticker_fixed_point(
+    simdjson::ondemand::parser &parser, std::string_view s,
+    FixedBookTicker &fx, bool set_recv_time, const SymbolLookup *symbol_lookup,
+    const SymbolScaleTable &scales) {
+  using namespace book_ticker_scan;
+
+  auto resolve_id = [&](std::string_view symbol) {
+    if (!symbol_lookup)
+      return true;
+    SymbolRef ref = find_symbol(*symbol_lookup, symbol);
+    if (ref.id < 0)
+      return false;
+    fx.id = ref.id;
+    fx.slot = ref.slot;
+    return true;
+  };
+
+  const char *p = s.data();
+  const char *end = p + s.size();
+  std::string_view symbol;
+  int64_t event_time;
+
+  // Fixed-layout fast path
+  if (expect(p, end, R"({"e":"bookTicker","u":)") &&
+      scan_int(p, end, fx.update_id) && expect(p, end, R"(,"s":")") &&
+      scan_quoted_string(p, end, symbol)) {
+    if (!resolve_id(symbol))
+      return ParseStatus::UnknownSymbol;
+    const SymbolScale &sc = scales[symbol_lookup ? fx.id : -1];
+    if (expect(p, end, R"(,"b":")") &&
+        scan_quoted_fixed(p, end, sc.price_decimals, fx.bid_price) &&
+        expect(p, end, R"(,"B":")") &&
+        scan_quoted_fixed(p, end, sc.qty_decimals, fx.bid_qty) &&
+        expect(p, end, R"(,"a":")") &&
+        scan_quoted_fixed(p, end, sc.price_decimals, fx.ask_price) &&
+        expect(p, end, R"(,"A":")") &&
+        scan_quoted_fixed(p, end, sc.qty_decimals, fx.ask_qty) &&
+        expect(p, end, R"(,"T":)") && scan_int(p, end, fx.trade_time) &&
+        expect(p, end, R"(,"E":)") && scan_int(p, end, event_time) &&
+        expect(p, end, "}")) {
+      fx.event_time_ms_midnight = cached_midnight_ms_utc(event_time);
+      if (set_recv_time)
+        fx.my_receive_time_ns = receive_time_ns();
+      return ParseStatus::Ok;
+    }
+  }
+
+  // Generic simdjson fallback
+  simdjson::ondemand::document doc;
+  simdjson::ondemand::object obj;
+  if (parser.iterate(padded_frame(s.data(), s.size(), s.size())).get(doc) ||
+      doc.get_object().get(obj))
+    return ParseStatus::MalformedJson;
+
+  if (auto err = obj["u"].get_int64().get(fx.update_id)) {
+    if (err == simdjson::NO_SUCH_FIELD &&
+        obj.find_field_unordered("id").error() == simdjson::SUCCESS)
+      return ParseStatus::ControlFrame;
+    return to_parse_status(err);
+  }
+  if (auto err = obj["s"].get_string().get(symbol))
+    return to_parse_status(err);
+  if (!resolve_id(symbol))
+    return ParseStatus::UnknownSymbol;
+  const SymbolScale &sc = scales[symbol_lookup ? fx.id : -1];
+
+  std::string_view bid_price_str, bid_qty_str, ask_price_str, ask_qty_str;
+  if (auto err = obj["b"].get_string().get(bid_price_str))
+    return to_parse_status(err);
+  if (auto err = obj["B"].get_string().get(bid_qty_str))
+    return to_parse_status(err);
+  if (auto err = obj["a"].get_string().get(ask_price_str))
+    return to_parse_status(err);
+  if (auto err = obj["A"].get_string().get(ask_qty_str))
+    return to_parse_status(err);
+  if (!parse_fixed_string(bid_price_str, sc.price_decimals, fx.bid_price) ||
+      !parse_fixed_string(bid_qty_str, sc.qty_decimals, fx.bid_qty) ||
+      !parse_fixed_string(ask_price_str, sc.price_decimals, fx.ask_price) ||
+      !parse_fixed_string(ask_qty_str, sc.qty_decimals, fx.ask_qty))
+    return ParseStatus::MalformedNumber;
+
+  if (auto err = obj["T"].get_int64().get(fx.trade_time))
+    return to_parse_status(err);
+  if (auto err = obj["E"].get_int64().get(event_time))
+    return to_parse_status(err);
+  fx.event_time_ms_midnight = cached_midnight_ms_utc(event_time);
+  if (set_recv_time)
+    fx.my_receive_time_ns = receive_time_ns();
+  return ParseStatus::Ok;
+}
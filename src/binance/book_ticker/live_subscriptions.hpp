@@ -0,0 +1,342 @@
+#pragma once
+
+#include "common/rcu_cell.hpp"
+#include "symbol_id_map.hpp"
+#include "symbol_lookup_table.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @class LiveSubscriptions
+ * @brief The subscription list and symbol lookup of a running producer,
+ * changeable without a reconnect.
+ *
+ * Each websocket connection registers itself with add_connection() and gets
+ * a connection index that is also its RcuCell reader slot. On the hot path a
+ * parse thread only does `lookup()` (one acquire load) and `quiescent(conn)`
+ * after the frame; handle() runs on the control thread, builds a new
+ * SymbolLookup off to the side and swaps it in, so the parse threads never
+ * wait on it.
+ *
+ * Ordering: a subscribe swaps the lookup in before sending SUBSCRIBE, so the
+ * first frames of a new symbol already resolve; an unsubscribe sends
+ * UNSUBSCRIBE first and swaps after, so frames still in flight are counted
+ * as `unknown_symbol` rather than mislabelled.
+ *
+ * Slots are dense: the initial symbols get 0..N-1 and a symbol subscribed
+ * later takes the next free slot on its first subscribe, up to
+ * slot_capacity() (`--max_symbols`), the size of every slot-indexed table
+ * downstream. A symbol keeps its BookTicker::slot across unsubscribe /
+ * subscribe, so slot-indexed state never changes meaning.
+ *
+ * With @p redundant (`--legs`) every connection carries every symbol; with
+ * shards a new symbol goes to the connection with the fewest subscriptions.
+ */
+class LiveSubscriptions {
+public:
+  /// Sends one text frame on a connection (e.g. ix::WebSocket::send).
+  using SendFn = std::function<void(const std::string &)>;
+
+  /**
+   * @param universe      Every symbol that may be subscribed, with its global
+   * ID (the symbol file).
+   * @param filtered_map  Initially subscribed symbols; they get slots 0..N-1
+   * (see assign_symbol_slots).
+   * @param slot_capacity Most symbols that can ever hold a slot; at least
+   * `filtered_map.size()` and at most 65536.
+   * @param redundant     Every connection carries every symbol.
+   */
+  LiveSubscriptions(const SymbolIdMap &universe,
+                    const SymbolIdMap &filtered_map, size_t slot_capacity,
+                    bool redundant = false)
+      : universe_(upper_keys(universe)),
+        assigned_(assign_symbol_slots(filtered_map)), subscribed_(assigned_),
+        slot_capacity_(check_capacity(slot_capacity, assigned_.size())),
+        slots_used_(assigned_.size()), redundant_(redundant),
+        lookup_(std::make_unique<SymbolLookup>(make_symbol_lookup(subscribed_)),
+                kMaxConnections) {}
+
+  /**
+   * @brief Registers a connection carrying @p subs (lowercase symbols);
+   * @p send is used for SUBSCRIBE / UNSUBSCRIBE issued by handle().
+   *
+   * @return the connection index, used for subscribe_message() and
+   * quiescent().
+   */
+  size_t add_connection(std::vector<std::string> subs, SendFn send) {
+    std::lock_guard lock(mutex_);
+    connections_.push_back({std::move(subs), std::move(send)});
+    size_t conn = lookup_.add_reader();
+    return conn;
+  }
+
+  /// Parse thread: the current lookup, valid until its next quiescent().
+  const SymbolLookup &lookup() const { return lookup_.read(); }
+
+  /// Parse thread: done with the lookup returned by lookup().
+  void quiescent(size_t conn) { lookup_.quiescent(conn); }
+
+  /**
+   * @brief SUBSCRIBE frame for everything connection @p conn currently
+   * carries (sent on every (re)connect); empty when it carries nothing.
+   */
+  std::string subscribe_message(size_t conn) {
+    std::lock_guard lock(mutex_);
+    const auto &subs = connections_[conn].subs;
+    return subs.empty() ? std::string() : stream_request("SUBSCRIBE", subs, 1);
+  }
+
+  /**
+   * @brief Executes one control request and returns the reply text.
+   *
+   * Requests (symbols case-insensitive, space separated):
+   * - `subscribe <symbol>...`   e.g. `subscribe solusdt dogeusdt`
+   * - `unsubscribe <symbol>...`
+   * - `list`                    currently subscribed symbols
+   *
+   * Replies start with `ok` or `error`. Unknown symbols fail the whole
+   * request; already (un)subscribed ones are skipped.
+   */
+  std::string handle(std::string_view request) {
+    std::istringstream in{std::string(request)};
+    std::string verb;
+    in >> verb;
+    std::vector<std::string> symbols;
+    for (std::string s; in >> s;)
+      symbols.push_back(to_lower(s));
+
+    std::vector<std::pair<size_t, std::string>> frames;
+    std::string reply;
+    {
+      std::lock_guard lock(mutex_);
+      if (verb == "list") {
+        reply = "ok";
+        for (const auto &[symbol, ref] : subscribed_)
+          reply += ' ' + symbol;
+        return reply;
+      }
+      if ((verb != "subscribe" && verb != "unsubscribe") || symbols.empty())
+        return "error usage: subscribe|unsubscribe <symbol>... | list";
+      for (const auto &s : symbols) {
+        if (universe_.find(to_upper(s)) == universe_.end())
+          return "error unknown symbol " + s;
+      }
+      try {
+        reply = verb == "subscribe" ? subscribe_locked(symbols, frames)
+                                    : unsubscribe_locked(symbols, frames);
+      } catch (const std::exception &e) {
+        return std::string("error ") + e.what();
+      }
+    }
+    // Send outside the lock: a connection's Open handler takes it too
+    for (const auto &[conn, frame] : frames)
+      connections_send(conn, frame);
+    if (!frames.empty() && verb == "unsubscribe")
+      publish_lookup();
+    return reply;
+  }
+
+  /// Number of subscribed symbols.
+  size_t size() {
+    std::lock_guard lock(mutex_);
+    return subscribed_.size();
+  }
+
+  /// Size of every slot-indexed table: slots are always below this.
+  size_t slot_capacity() const { return slot_capacity_; }
+
+  /// Slots handed out so far (0..slots_used()-1); grows on new subscribes.
+  size_t slots_used() const {
+    return slots_used_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Slot → symbol name for every slot handed out so far, sized to
+   * slot_capacity() (unused slots are empty). Takes the control lock, so
+   * a hot thread should only call it when slots_used() has grown.
+   */
+  std::vector<std::string> slot_names() {
+    std::lock_guard lock(mutex_);
+    std::vector<std::string> names(slot_capacity_);
+    for (const auto &[symbol, ref] : assigned_)
+      names[ref.slot] = symbol;
+    return names;
+  }
+
+  /// Retired lookups still waiting for a parse thread to move past them.
+  size_t pending_reclaim() { return lookup_.reclaim(); }
+
+private:
+  static constexpr size_t kMaxConnections = 64;
+
+  struct Connection {
+    std::vector<std::string> subs; ///< lowercase, as in StreamConfig::subs
+    SendFn send;
+  };
+
+  static std::string to_lower(std::string s) {
+    for (char &c : s)
+      c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return s;
+  }
+
+  static std::string stream_request(const char *method,
+                                    const std::vector<std::string> &symbols,
+                                    int id) {
+    std::vector<std::string> streams;
+    for (const auto &sym : symbols)
+      streams.push_back(sym + "@bookTicker");
+    nlohmann::json msg = {{"method", method}, {"params", streams}, {"id", id}};
+    return msg.dump();
+  }
+
+  std::string subscribe_locked(const std::vector<std::string> &symbols,
+                               std::vector<std::pair<size_t, std::string>> &frames) {
+    std::vector<std::string> added;
+    for (const auto &s : symbols) {
+      std::string upper = to_upper(s);
+      if (subscribed_.find(upper) == subscribed_.end() &&
+          std::ranges::find(added, s) == added.end())
+        added.push_back(s);
+    }
+    if (added.empty())
+      return "ok subscribed 0";
+    SymbolSlotMap next = subscribed_;
+    SymbolSlotMap new_slots;
+    size_t used = assigned_.size();
+    for (const auto &s : added) {
+      std::string upper = to_upper(s);
+      auto it = assigned_.find(upper);
+      if (it != assigned_.end()) {
+        next.emplace(upper, it->second);
+        continue;
+      }
+      if (used == slot_capacity_)
+        return "error no free slot for " + s + " (--max_symbols " +
+               std::to_string(slot_capacity_) + ")";
+      SymbolRef ref{static_cast<int16_t>(universe_.find(upper)->second),
+                    static_cast<uint16_t>(used++)};
+      next.emplace(upper, ref);
+      new_slots.emplace(upper, ref);
+    }
+    // Build first: a stale perfect-hash table throws here, before any change
+    auto lookup = std::make_unique<SymbolLookup>(make_symbol_lookup(next));
+    assigned_.insert(new_slots.begin(), new_slots.end());
+    slots_used_.store(assigned_.size(), std::memory_order_release);
+    subscribed_ = std::move(next);
+    lookup_.publish(std::move(lookup));
+
+    std::vector<std::vector<std::string>> per_conn(connections_.size());
+    for (const auto &s : added) {
+      if (redundant_) {
+        for (size_t k = 0; k < connections_.size(); ++k) {
+          per_conn[k].push_back(s);
+          connections_[k].subs.push_back(s);
+        }
+      } else if (!connections_.empty()) {
+        auto it = std::ranges::min_element(connections_, {}, [](const auto &c) {
+          return c.subs.size();
+        });
+        size_t k = static_cast<size_t>(it - connections_.begin());
+        per_conn[k].push_back(s);
+        it->subs.push_back(s);
+      }
+    }
+    queue_frames("SUBSCRIBE", per_conn, frames);
+    return "ok subscribed " + std::to_string(added.size());
+  }
+
+  std::string
+  unsubscribe_locked(const std::vector<std::string> &symbols,
+                     std::vector<std::pair<size_t, std::string>> &frames) {
+    std::vector<std::vector<std::string>> per_conn(connections_.size());
+    size_t removed = 0;
+    for (const auto &s : symbols) {
+      if (subscribed_.erase(to_upper(s)) == 0)
+        continue;
+      ++removed;
+      for (size_t k = 0; k < connections_.size(); ++k) {
+        auto &subs = connections_[k].subs;
+        if (std::erase(subs, s))
+          per_conn[k].push_back(s);
+      }
+    }
+    next_lookup_ = std::make_unique<SymbolLookup>(make_symbol_lookup(subscribed_));
+    queue_frames("UNSUBSCRIBE", per_conn, frames);
+    if (frames.empty())
+      publish_lookup_locked();
+    return "ok unsubscribed " + std::to_string(removed);
+  }
+
+  void queue_frames(const char *method,
+                    const std::vector<std::vector<std::string>> &per_conn,
+                    std::vector<std::pair<size_t, std::string>> &frames) {
+    for (size_t k = 0; k < per_conn.size(); ++k) {
+      if (!per_conn[k].empty())
+        frames.emplace_back(k, stream_request(method, per_conn[k],
+                                              ++request_id_));
+    }
+  }
+
+  void connections_send(size_t conn, const std::string &frame) {
+    SendFn send;
+    {
+      std::lock_guard lock(mutex_);
+      send = connections_[conn].send;
+    }
+    if (send)
+      send(frame);
+  }
+
+  void publish_lookup() {
+    std::lock_guard lock(mutex_);
+    publish_lookup_locked();
+  }
+
+  void publish_lookup_locked() {
+    if (next_lookup_)
+      lookup_.publish(std::move(next_lookup_));
+  }
+
+  static SymbolIdMap upper_keys(const SymbolIdMap &map) {
+    SymbolIdMap out;
+    for (const auto &[symbol, id] : map)
+      out.emplace(to_upper(symbol), id);
+    return out;
+  }
+
+  static size_t check_capacity(size_t capacity, size_t initial) {
+    if (capacity < initial)
+      throw std::runtime_error("❌ --max_symbols " + std::to_string(capacity) +
+                               " is below the " + std::to_string(initial) +
+                               " subscribed symbols");
+    if (capacity > std::numeric_limits<uint16_t>::max() + size_t{1})
+      throw std::runtime_error("❌ --max_symbols exceeds 16-bit slots");
+    return capacity;
+  }
+
+  SymbolIdMap universe_;     ///< uppercase keys
+  SymbolSlotMap assigned_;   ///< every symbol given a slot so far, uppercase
+  SymbolSlotMap subscribed_; ///< uppercase keys, as the parsers see them
+  size_t slot_capacity_;
+  std::atomic<size_t> slots_used_; ///< assigned_.size(), for slot_names()
+  bool redundant_;
+  RcuCell<SymbolLookup> lookup_;
+  std::unique_ptr<SymbolLookup> next_lookup_; ///< Built, waiting on UNSUBSCRIBE
+  std::vector<Connection> connections_;
+  int request_id_ = 1; ///< 1 is the initial SUBSCRIBE on Open
+  std::mutex mutex_;
+};
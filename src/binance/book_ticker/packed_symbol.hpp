@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief A symbol name packed into two little-endian 64-bit words.
+ *
+ * Binance symbols are at most 15 characters, so every symbol fits in 16 bytes
+ * zero-padded. Comparing two symbols is then a single 16-byte compare instead
+ * of a length check plus memcmp.
+ */
+struct alignas(16) PackedSymbol {
+  uint64_t lo = 0;
+  uint64_t hi = 0;
+};
+
+/// Longest symbol that can be packed.
+inline constexpr size_t kMaxPackedSymbolLen = sizeof(PackedSymbol);
+
+/**
+ * @brief Packs @p s into a PackedSymbol.
+ * @return false if @p s is empty or longer than kMaxPackedSymbolLen.
+ */
+inline bool pack_symbol(std::string_view s, PackedSymbol &out) {
+  if (s.empty() || s.size() > kMaxPackedSymbolLen)
+    return false;
+  unsigned char buf[kMaxPackedSymbolLen] = {};
+  std::memcpy(buf, s.data(), s.size());
+  std::memcpy(&out.lo, buf, 8);
+  std::memcpy(&out.hi, buf + 8, 8);
+  return true;
+}
+
+/// 16-byte equality, using one SSE2 compare when available.
+inline bool packed_equal(const PackedSymbol &a, const PackedSymbol &b) {
+#if defined(__SSE2__)
+  __m128i va = _mm_load_si128(reinterpret_cast<const __m128i *>(&a));
+  __m128i vb = _mm_load_si128(reinterpret_cast<const __m128i *>(&b));
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) == 0xFFFF;
+#else
+  return ((a.lo ^ b.lo) | (a.hi ^ b.hi)) == 0;
+#endif
+}
+
+/**
+ * @brief Seeded 64-bit mix of a packed symbol. Must stay bit-for-bit in sync
+ * with `packed_hash` in src/symbols/generate_symbol_files.py, which uses it to
+ * build the generated perfect-hash table.
+ */
+constexpr uint64_t packed_hash(uint64_t lo, uint64_t hi, uint64_t seed) {
+  uint64_t h = (lo ^ seed) * 0x9E3779B97F4A7C15ULL;
+  h ^= hi + (h >> 29);
+  h *= 0xC2B2AE3D27D4EB4FULL;
+  return h ^ (h >> 32);
+}
+
+/// Maps a 64-bit hash onto [0, n) with a multiply instead of a modulo.
+constexpr uint32_t fast_range(uint64_t h, uint32_t n) {
+  return static_cast<uint32_t>(((h >> 32) * n) >> 32);
+}
+
+/**
+ * @brief Entry of the generated perfect-hash table
+ * (symbol_perfect_hash.hpp).
+ */
+struct PerfectHashEntry {
+  PackedSymbol key;
+  int32_t id;
+};
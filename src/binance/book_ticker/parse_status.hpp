@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @brief Outcome of an exception-free bookTicker parse.
+ */
+enum class ParseStatus : uint8_t {
+  Ok,              ///< Ticker parsed successfully
+  ControlFrame,    ///< Non-ticker frame, e.g. the `{"result":null,"id":1}` ack
+  MalformedJson,   ///< Not valid JSON, not an object, or a field of wrong type
+  MissingField,    ///< A required bookTicker field is absent
+  MalformedNumber, ///< A price/quantity/integer field failed to convert
+  UnknownSymbol,   ///< Symbol not present in the lookup table
+  Count            ///< Number of statuses (not a status)
+};
+
+inline const char *to_string(ParseStatus status) {
+  switch (status) {
+  case ParseStatus::Ok:
+    return "ok";
+  case ParseStatus::ControlFrame:
+    return "control_frame";
+  case ParseStatus::MalformedJson:
+    return "malformed_json";
+  case ParseStatus::MissingField:
+    return "missing_field";
+  case ParseStatus::MalformedNumber:
+    return "malformed_number";
+  case ParseStatus::UnknownSymbol:
+    return "unknown_symbol";
+  default:
+    return "unknown";
+  }
+}
+
+/**
+ * @struct ParseCounters
+ * @brief Per-status counters bumped by the websocket thread(s) and read by
+ * the monitor thread.
+ *
+ * Counting replaces logging on the hot path: a burst of bad frames costs one
+ * relaxed atomic increment each instead of a stderr write (and, previously, an
+ * exception unwind).
+ */
+struct ParseCounters {
+  std::array<std::atomic<uint64_t>, static_cast<size_t>(ParseStatus::Count)>
+      counts{};
+
+  void add(ParseStatus status) {
+    counts[static_cast<size_t>(status)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t get(ParseStatus status) const {
+    return counts[static_cast<size_t>(status)].load(std::memory_order_relaxed);
+  }
+
+  /// Writes the non-zero counters as `name=value` pairs on one line.
+  void print(std::ostream &os) const {
+    os << "parse status:";
+    for (size_t i = 0; i < counts.size(); ++i) {
+      uint64_t n = counts[i].load(std::memory_order_relaxed);
+      if (n)
+        os << ' ' << to_string(static_cast<ParseStatus>(i)) << '=' << n;
+    }
+    os << '\n';
+  }
+};
@@ -1,11 +1,17 @@
 #include "book_ticker_parser.hpp"
+#include "book_ticker_scanner.hpp"
+#include "fixed_book_ticker.hpp"
+#include "parse_status.hpp"
 #include "book_ticker_queue.hpp"
+#include "common/thread_affinity.hpp"
+#include "common/wait_strategy.hpp"
+#include "live_subscriptions.hpp"
 #include "stream_config.hpp"
 #include "symbol_id_map.hpp"
 #include <iostream>
 #include <ixwebsocket/IXWebSocket.h>
-#include <nlohmann/json.hpp>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 /**
@@ -19,73 +25,119 @@
  * @param ws           Reference to the ix::WebSocket instance to configure and
  * start.
  * @param cfg          Stream configuration including the WebSocket endpoint and
- * symbol subscriptions.
- * @param filtered_map Map of symbol strings to integer IDs used for efficient
- * symbol lookup.
- * @param queue        Optional pointer to a BookTickerQueue. If provided,
- * parsed BookTicker messages will be enqueued; otherwise, messages are parsed
- * but discarded.
+ * the symbols this connection initially subscribes to.
+ * @param subscriptions Live subscription list and symbol → ID lookup; the
+ * connection registers with it, parses against its current lookup and
+ * re-sends its current list on every (re)connect (see LiveSubscriptions).
+ * @param queue        Optional pointer to the hand-off queue (BookTickerQueue,
+ * SpscBookTickerQueue or ConflatingBookTickerBuffer, or their FixedBookTicker
+ * counterparts; anything with `try_enqueue(const queue_ticker_t<Queue> &)`).
+ * If provided, parsed tickers will be enqueued; otherwise, messages are
+ * parsed but discarded.
+ * @param parser_kind  Parsing strategy (generic simdjson or fixed-layout
+ * scanner with simdjson fallback).
+ * @param parse_counters Optional per-status counters; every frame bumps
+ * exactly one of them.
+ * @param doorbell     Optional doorbell rung after each enqueue, for a
+ * consumer using WaitKind::SpinPark.
+ * @param thread_placements Optional placements; the entry named
+ * @p thread_name is applied to the IXWebSocket thread on its first callback.
+ * @param thread_name  Thread / placement name ("ws", or "ws<k>" for shard k).
+ * @param scales       Per-symbol decimals; required when @p Queue carries
+ * FixedBookTicker (`--prices fixed`), in which case frames are parsed with
+ * parse_book_ticker_fixed_point and @p parser_kind does not apply.
  *
  * Notes:
  * - Uses thread-local simdjson parser for high-throughput, thread-safe JSON
  * parsing.
+ * - Parsing is exception-free (parse_book_ticker_ec); failures and control
+ * frames are counted in @p parse_counters rather than logged.
  * - Drops are counted and logged if the queue is full or memory allocation
  * fails.
+ * - The lookup is read once per frame and released (RCU quiescent point)
+ * right after parsing, so control-channel swaps never block this thread.
  * - Throws an exception if more than 500 messages are dropped.
  * - Assumes messages are in Binance Perpetual Futures bookTicker format.
  */
 
+template <typename Queue = BookTickerQueue>
 inline void setup_websocket(ix::WebSocket &ws, const StreamConfig &cfg,
-                            const SymbolIdMap &filtered_map,
-                            BookTickerQueue *queue, bool debug) {
+                            LiveSubscriptions &subscriptions, Queue *queue,
+                            bool debug,
+                            ParserKind parser_kind = ParserKind::Simdjson,
+                            ParseCounters *parse_counters = nullptr,
+                            Doorbell *doorbell = nullptr,
+                            const ThreadPlacementMap *thread_placements =
+                                nullptr,
+                            std::string thread_name = "ws",
+                            const SymbolScaleTable *scales = nullptr) {
+  using Ticker = queue_ticker_t<Queue>;
   ws.setUrl(cfg.endpoint);
+  const size_t conn = subscriptions.add_connection(
+      cfg.subs, [&ws](const std::string &frame) { ws.send(frame); });
 
-  ws.setOnMessageCallback([&ws, cfg, &filtered_map, queue,
-                           debug](const ix::WebSocketMessagePtr &msg) {
+  ws.setOnMessageCallback([&ws, conn, &subscriptions, queue, debug,
+                           parser_kind, parse_counters, doorbell,
+                           thread_placements, thread_name, scales](
+                              const ix::WebSocketMessagePtr &msg) {
     thread_local simdjson::ondemand::parser parser;
-    thread_local BookTicker ticker;
+    thread_local Ticker ticker;
+    thread_local bool placed = false;
     using ix::WebSocketMessageType;
 
+    if (!placed) {
+      if (thread_placements)
+        apply_thread_placement(thread_name, *thread_placements);
+      placed = true;
+    }
+
     switch (msg->type) {
     case WebSocketMessageType::Message:
       if (debug)
         std::cerr << "Received: " << msg->str << std::endl;
-      try {
-        parse_book_ticker(parser, msg->str, ticker, true, &filtered_map);
-        if (queue && !queue->try_enqueue(ticker)) {
-          static std::atomic<int> drop_count = 0;
-          drop_count++;
-          std::cerr << "⚠️ Queue full or memory error. Drop count: "
-                    << drop_count.load() << "\n";
-          if (drop_count.load() > 500) {
-            throw std::runtime_error("drop count exceeded");
-          }
+      {
+        ParseStatus status;
+        if constexpr (std::is_same_v<Ticker, FixedBookTicker>)
+          status = parse_book_ticker_fixed_point(
+              parser, msg->str, ticker, true, &subscriptions.lookup(), *scales);
+        else
+          status = parse_book_ticker_ec(parser_kind, parser, msg->str, ticker,
+                                        true, &subscriptions.lookup());
+        subscriptions.quiescent(conn);
+        if (parse_counters)
+          parse_counters->add(status);
+        if (status != ParseStatus::Ok) {
+          if (debug)
+            std::cerr << "Parse status: " << to_string(status) << std::endl;
+          break;
         }
-
-      } catch (simdjson::simdjson_error &err) {
-        std::cerr << err.what() << std::endl;
+      }
+      if (queue && !queue->try_enqueue(ticker)) {
+        static std::atomic<int> drop_count = 0;
+        drop_count++;
+        std::cerr << "⚠️ Queue full or memory error. Drop count: "
+                  << drop_count.load() << "\n";
+        if (drop_count.load() > 500) {
+          throw std::runtime_error("drop count exceeded");
+        }
+      } else if (doorbell) {
+        doorbell->ring();
       }
       break;
 
     case WebSocketMessageType::Open:
       std::cout << "Connection established, sending subscribe message..."
                 << std::endl;
-      {
-        std::vector<std::string> streams;
-        for (const auto &sym : cfg.subs) {
-          streams.push_back(sym + "@bookTicker");
-        }
-
-        nlohmann::json sub_msg = {
-            {"method", "SUBSCRIBE"}, {"params", streams}, {"id", 1}};
-
-        ws.send(sub_msg.dump());
-      }
+      if (std::string sub_msg = subscriptions.subscribe_message(conn);
+          !sub_msg.empty())
+        ws.send(sub_msg);
       break;
 
     case WebSocketMessageType::Ping:
       std::cout << "[Ping] Received from server, sending Pong..." << std::endl;
       // ws.pong(msg->str);
+      // Lets an idle connection release retired lookups too
+      subscriptions.quiescent(conn);
       break;
 
     case WebSocketMessageType::Pong:
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/tsc_clock.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @class ShardedBookTickerQueue
+ * @brief Merges K per-connection SPSC rings into one consumer-side queue.
+ *
+ * Each websocket shard parses on its own network thread and enqueues into
+ * its own SpscBookTickerQueue (shard(k)), so producers never share a cache
+ * line. The consumer dequeues through the usual queue API (try_dequeue,
+ * try_dequeue_bulk, size_approx), which drains the shards round-robin
+ * starting one shard later on every call, so a busy shard cannot starve the
+ * others. Per-symbol order is preserved because a symbol lives on exactly
+ * one shard.
+ *
+ * Per-shard message counts and receive → dequeue latency are recorded on the
+ * consumer thread and reported by print().
+ */
+class ShardedBookTickerQueue {
+public:
+  explicit ShardedBookTickerQueue(size_t shards) : shards_(shards) {
+    for (Shard &s : shards_)
+      s.ring = std::make_unique<SpscBookTickerQueue>();
+  }
+
+  size_t shards() const { return shards_.size(); }
+
+  /// Producer side of shard @p k (one websocket thread).
+  SpscBookTickerQueue &shard(size_t k) { return *shards_[k].ring; }
+
+  bool try_dequeue(BookTicker &out) { return try_dequeue_bulk(&out, 1) == 1; }
+
+  /// Consumer: dequeues up to @p max tickers across the shards.
+  template <typename It> size_t try_dequeue_bulk(It out, size_t max) {
+    const size_t k = shards_.size();
+    size_t n = 0;
+    for (size_t i = 0; i < k && n < max; ++i) {
+      Shard &s = shards_[(next_ + i) % k];
+      size_t got = s.ring->try_dequeue_bulk(out, max - n);
+      if (got) {
+        const int64_t now = receive_time_ns();
+        for (size_t j = 0; j < got; ++j, ++out)
+          s.latency.record(now - (*out).my_receive_time_ns);
+        s.count += got;
+        n += got;
+      }
+    }
+    next_ = (next_ + 1) % k;
+    return n;
+  }
+
+  size_t size_approx() const {
+    size_t n = 0;
+    for (const Shard &s : shards_)
+      n += s.ring->size_approx();
+    return n;
+  }
+
+  /// Prints per-shard rate and latency since the last call, then resets.
+  void print(std::ostream &os) {
+    const auto now = std::chrono::steady_clock::now();
+    const double secs =
+        std::chrono::duration<double>(now - last_print_).count();
+    last_print_ = now;
+    for (size_t k = 0; k < shards_.size(); ++k) {
+      Shard &s = shards_[k];
+      os << "shard " << k << ": " << s.count << " msgs ("
+         << static_cast<int64_t>(secs > 0 ? s.count / secs : 0) << " msg/s) ";
+      s.latency.print(os, "latency");
+      s.count = 0;
+      s.latency.reset();
+    }
+  }
+
+private:
+  struct Shard {
+    std::unique_ptr<SpscBookTickerQueue> ring;
+    uint64_t count = 0;
+    LatencyHistogram latency;
+  };
+
+  std::vector<Shard> shards_;
+  size_t next_ = 0;
+  std::chrono::steady_clock::time_point last_print_ =
+      std::chrono::steady_clock::now();
+};
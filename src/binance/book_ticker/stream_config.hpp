@@ -1,8 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <nlohmann/json.hpp>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 
@@ -19,6 +21,10 @@ struct StreamConfig {
 
   /// List of subscribed symbols
   std::vector<std::string> subs;
+
+  /// Number of websocket connections the subs are split across ("shards",
+  /// optional, default 1)
+  int shards = 1;
 };
 
 /**
@@ -43,17 +49,40 @@ struct StreamConfig {
  *   "subs": {
  *     "btcusdt": 1,
  *     "ethusdt": 2
- *   }
+ *   },
+ *   "shards": 2
  * }
  */
 inline void from_json(const nlohmann::json &j, StreamConfig &config) {
   j.at("endpoint").get_to(config.endpoint);
   j.at("subs").get_to(config.subs);
+  config.shards = j.value("shards", 1);
+  if (config.shards < 1)
+    throw std::runtime_error("\"shards\" must be >= 1");
 }
 
 /// JSON serialization for StreamConfig
 inline void to_json(nlohmann::json &j, const StreamConfig &config) {
-  j = nlohmann::json{{"endpoint", config.endpoint}, {"subs", config.subs}};
+  j = nlohmann::json{{"endpoint", config.endpoint},
+                     {"subs", config.subs},
+                     {"shards", config.shards}};
+}
+
+/**
+ * @brief Splits @p cfg into `cfg.shards` configs on the same endpoint, dealing
+ * the subs round-robin so each connection gets an even share of symbols.
+ *
+ * Never returns an empty shard: the count is capped at the number of subs.
+ */
+inline std::vector<StreamConfig> shard_stream_config(const StreamConfig &cfg) {
+  size_t shards = std::clamp<size_t>(static_cast<size_t>(cfg.shards), 1,
+                                     std::max<size_t>(cfg.subs.size(), 1));
+  std::vector<StreamConfig> out(shards);
+  for (size_t k = 0; k < shards; ++k)
+    out[k].endpoint = cfg.endpoint;
+  for (size_t i = 0; i < cfg.subs.size(); ++i)
+    out[i % shards].subs.push_back(cfg.subs[i]);
+  return out;
 }
 
 /// A mapping from "spot" / "fut" → StreamConfig
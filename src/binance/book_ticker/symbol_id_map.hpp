@@ -5,13 +5,51 @@
 #include <cctype>    // std::toupperg
 #include <cstdint>
 #include <fstream>
+#include <limits>
 #include <nlohmann/json.hpp>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Transparent hash for symbol keys so lookups can be done directly
+ * from a std::string_view (e.g. a slice of the raw frame) without building a
+ * temporary std::string.
+ */
+struct SymbolHash {
+  using is_transparent = void;
+
+  size_t operator()(std::string_view s) const noexcept {
+    return robin_hood::hash_bytes(s.data(), s.size());
+  }
+};
 
 /// Alias for a fast flat hash map from symbol name to integer ID
-using SymbolIdMap = robin_hood::unordered_flat_map<std::string, int32_t>;
+using SymbolIdMap =
+    robin_hood::unordered_flat_map<std::string, int32_t, SymbolHash,
+                                   std::equal_to<>>;
 using ReverseSymbolIdMap = robin_hood::unordered_flat_map<int32_t, std::string>;
 
+/// Largest global symbol ID (BookTicker::id is an int16_t)
+inline constexpr int32_t kMaxSymbolId = std::numeric_limits<int16_t>::max();
+
+/**
+ * @struct SymbolRef
+ * @brief A subscribed symbol as the parsers see it: its global ID (kept for
+ * the wire) and its dense per-stream slot 0..N-1 (for flat per-symbol arrays).
+ * `id < 0` means "not subscribed".
+ */
+struct SymbolRef {
+  int16_t id = -1;
+  uint16_t slot = 0;
+};
+
+/// Symbol name (uppercase) → SymbolRef for the subscribed symbols
+using SymbolSlotMap =
+    robin_hood::unordered_flat_map<std::string, SymbolRef, SymbolHash,
+                                   std::equal_to<>>;
+
 /**
  * @brief Convert a JSON object of string→int into a SymbolIdMap with uppercase
  * keys.
@@ -87,7 +125,11 @@ SymbolIdMap load_symbol_map(const std::string &filename) {
     if (!value.is_number_integer()) {
       throw std::runtime_error("❌ Invalid value type for key: " + key);
     }
-    symbol_map[key] = value.get<int32_t>();
+    int32_t id = value.get<int32_t>();
+    if (id < 0 || id > kMaxSymbolId) {
+      throw std::runtime_error("❌ Symbol ID out of range for key: " + key);
+    }
+    symbol_map[key] = id;
   }
 
   return symbol_map;
@@ -106,7 +148,7 @@ SymbolIdMap load_symbol_map(const std::string &filename) {
 SymbolIdMap filter_symbol_map(const SymbolIdMap &full_map,
                               const std::vector<std::string> &symbols_to_keep) {
 
-  robin_hood::unordered_flat_map<std::string, int32_t> filtered_map;
+  SymbolIdMap filtered_map;
   for (const auto &symbol : symbols_to_keep) {
     auto it = full_map.find(symbol);
     if (it != full_map.end()) {
@@ -117,6 +159,72 @@ SymbolIdMap filter_symbol_map(const SymbolIdMap &full_map,
   return filtered_map;
 }
 
+/**
+ * @brief Number of slots needed to index a table directly by the IDs in
+ * @p map (largest ID + 1; 0 for an empty map).
+ */
+inline size_t symbol_id_span(const SymbolIdMap &map) {
+  int32_t max_id = -1;
+  for (const auto &[symbol, id] : map)
+    max_id = std::max(max_id, id);
+  return static_cast<size_t>(max_id + 1);
+}
+
+/**
+ * @brief Gives each symbol of @p map a dense slot 0..N-1, in global-ID order
+ * so the assignment is reproducible. Keys are uppercased.
+ */
+inline SymbolSlotMap assign_symbol_slots(const SymbolIdMap &map) {
+  std::vector<std::pair<int32_t, std::string>> by_id;
+  for (const auto &[symbol, id] : map)
+    by_id.emplace_back(id, to_upper(symbol));
+  std::ranges::sort(by_id);
+  if (by_id.size() > std::numeric_limits<uint16_t>::max() + size_t{1}) {
+    throw std::runtime_error("❌ Too many symbols for 16-bit slots");
+  }
+  SymbolSlotMap slots;
+  for (size_t i = 0; i < by_id.size(); ++i) {
+    slots.emplace(by_id[i].second,
+                  SymbolRef{static_cast<int16_t>(by_id[i].first),
+                            static_cast<uint16_t>(i)});
+  }
+  return slots;
+}
+
+/**
+ * @brief filter_symbol_map plus the dense slots of the kept symbols (see
+ * assign_symbol_slots).
+ */
+inline SymbolSlotMap
+filter_symbol_slots(const SymbolIdMap &full_map,
+                    const std::vector<std::string> &symbols_to_keep) {
+  return assign_symbol_slots(filter_symbol_map(full_map, symbols_to_keep));
+}
+
+/// Number of slots to size a slot-indexed array for @p slots.
+inline size_t symbol_slot_count(const SymbolSlotMap &slots) {
+  size_t n = 0;
+  for (const auto &[symbol, ref] : slots)
+    n = std::max<size_t>(n, size_t{ref.slot} + 1);
+  return n;
+}
+
+/// Largest global ID + 1 (see symbol_id_span).
+inline size_t symbol_id_span(const SymbolSlotMap &slots) {
+  int32_t max_id = -1;
+  for (const auto &[symbol, ref] : slots)
+    max_id = std::max<int32_t>(max_id, ref.id);
+  return static_cast<size_t>(max_id + 1);
+}
+
+/// Slot → symbol name, the flat replacement for a reverse hash map.
+inline std::vector<std::string> symbol_slot_names(const SymbolSlotMap &slots) {
+  std::vector<std::string> names(symbol_slot_count(slots));
+  for (const auto &[symbol, ref] : slots)
+    names[ref.slot] = symbol;
+  return names;
+}
+
 
 ReverseSymbolIdMap make_reverse_symbol_map(const std::string &filename) {
     std::ifstream in_file(filename);
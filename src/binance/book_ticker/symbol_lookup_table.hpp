@@ -0,0 +1,171 @@
+#pragma once
+
+#include "packed_symbol.hpp"
+#include "symbol_id_map.hpp"
+#include "symbol_perfect_hash.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @class PackedSymbolTable
+ * @brief Open-addressing symbol → SymbolRef table keyed on PackedSymbol.
+ *
+ * Built once from a (small) SymbolSlotMap. Capacity is a power of two
+ * at least 4× the number of symbols so probes are almost always one slot.
+ * Empty slots hold the all-zero key, which no real symbol packs to.
+ */
+class PackedSymbolTable {
+public:
+  PackedSymbolTable() = default;
+
+  explicit PackedSymbolTable(const SymbolSlotMap &map) {
+    size_t cap = std::bit_ceil(std::max<size_t>(4 * map.size(), 8));
+    keys_.assign(cap, PackedSymbol{});
+    refs_.assign(cap, SymbolRef{});
+    mask_ = cap - 1;
+    for (const auto &[symbol, ref] : map) {
+      PackedSymbol key;
+      if (!pack_symbol(symbol, key)) {
+        throw std::runtime_error("❌ Symbol too long to pack: " + symbol);
+      }
+      size_t i = hash(key) & mask_;
+      while (refs_[i].id >= 0)
+        i = (i + 1) & mask_;
+      keys_[i] = key;
+      refs_[i] = ref;
+    }
+  }
+
+  /// @return the symbol's ID and slot; `id < 0` if it is not in the table.
+  SymbolRef find(std::string_view symbol) const {
+    PackedSymbol key;
+    if (!pack_symbol(symbol, key) || keys_.empty())
+      return {};
+    for (size_t i = hash(key) & mask_;; i = (i + 1) & mask_) {
+      if (packed_equal(keys_[i], key))
+        return refs_[i];
+      if (refs_[i].id < 0)
+        return {};
+    }
+  }
+
+private:
+  std::vector<PackedSymbol> keys_;
+  std::vector<SymbolRef> refs_;
+  size_t mask_ = 0;
+
+  static size_t hash(const PackedSymbol &k) {
+    return static_cast<size_t>(packed_hash(k.lo, k.hi, 0));
+  }
+};
+
+/**
+ * @brief Looks @p symbol up in the generated compile-time perfect-hash table
+ * (all symbols from symbols.json, uppercase).
+ *
+ * One hash picks a bucket, whose displacement seed feeds a second hash that
+ * lands on the only slot the symbol can occupy; a single 16-byte compare
+ * confirms the hit.
+ *
+ * @return the symbol's global ID, or -1 if it is not in the table.
+ */
+inline int32_t perfect_hash_symbol_id(std::string_view symbol) {
+  using namespace symbol_perfect_hash;
+  PackedSymbol key;
+  if (!pack_symbol(symbol, key))
+    return -1;
+  uint32_t seed =
+      kSeeds[fast_range(packed_hash(key.lo, key.hi, 0), kNumBuckets)];
+  const PerfectHashEntry &e =
+      kTable[fast_range(packed_hash(key.lo, key.hi, seed), kTableSize)];
+  return packed_equal(e.key, key) ? e.id : -1;
+}
+
+/**
+ * @class PerfectHashSymbolLookup
+ * @brief Restricts the generated perfect-hash table to the subscribed symbols.
+ *
+ * The constructor verifies that every subscribed symbol resolves to the same
+ * ID as in the runtime symbol file, so a stale generated table fails loudly at
+ * startup instead of mislabelling ticks. Slots come from a flat array indexed
+ * by the global ID.
+ */
+class PerfectHashSymbolLookup {
+public:
+  PerfectHashSymbolLookup() = default;
+
+  explicit PerfectHashSymbolLookup(const SymbolSlotMap &map) {
+    for (const auto &[symbol, ref] : map) {
+      if (perfect_hash_symbol_id(symbol) != ref.id) {
+        throw std::runtime_error(
+            "❌ symbol_perfect_hash.hpp is out of date for " + symbol +
+            "; rerun generate_symbol_files.py");
+      }
+      if (static_cast<size_t>(ref.id) >= refs_.size())
+        refs_.resize(static_cast<size_t>(ref.id) + 1);
+      refs_[ref.id] = ref;
+    }
+  }
+
+  /// @return the symbol's ID and slot; `id < 0` if it is unknown or not
+  /// subscribed.
+  SymbolRef find(std::string_view symbol) const {
+    int32_t id = perfect_hash_symbol_id(symbol);
+    return (id >= 0 && static_cast<size_t>(id) < refs_.size()) ? refs_[id]
+                                                               : SymbolRef{};
+  }
+
+private:
+  std::vector<SymbolRef> refs_; ///< by global ID; unsubscribed have id -1
+};
+
+/// Symbol → ID/slot lookup using the SymbolSlotMap directly (default build).
+inline SymbolRef find_symbol(const SymbolSlotMap &map,
+                             std::string_view symbol) {
+  auto it = map.find(symbol);
+  return it != map.end() ? it->second : SymbolRef{};
+}
+
+inline SymbolRef find_symbol(const PackedSymbolTable &table,
+                             std::string_view symbol) {
+  return table.find(symbol);
+}
+
+inline SymbolRef find_symbol(const PerfectHashSymbolLookup &table,
+                             std::string_view symbol) {
+  return table.find(symbol);
+}
+
+/// Global ID only; -1 if the symbol is not in @p lookup.
+template <typename Lookup>
+inline int32_t find_symbol_id(const Lookup &lookup, std::string_view symbol) {
+  return find_symbol(lookup, symbol).id;
+}
+
+/**
+ * @brief Symbol lookup structure used by the parsers, chosen at build time
+ * with the CMake option `SYMBOL_LOOKUP` (robin_hood | packed | perfect_hash).
+ */
+#if defined(SYMBOL_LOOKUP_PERFECT_HASH)
+using SymbolLookup = PerfectHashSymbolLookup;
+#elif defined(SYMBOL_LOOKUP_PACKED)
+using SymbolLookup = PackedSymbolTable;
+#else
+using SymbolLookup = SymbolSlotMap;
+#endif
+
+/// Builds the configured SymbolLookup from the subscribed symbols' slots.
+inline SymbolLookup make_symbol_lookup(const SymbolSlotMap &slots) {
+  return SymbolLookup(slots);
+}
+
+/// Builds the configured SymbolLookup from a filtered symbol → ID map,
+/// assigning dense slots in ID order (see assign_symbol_slots).
+inline SymbolLookup make_symbol_lookup(const SymbolIdMap &filtered_map) {
+  return make_symbol_lookup(assign_symbol_slots(filtered_map));
+}
@@ -0,0 +1,1842 @@
+// Generated by src/symbols/generate_symbol_files.py -- do not edit.
+#pragma once
+
+#include "packed_symbol.hpp"
+#include <cstdint>
+
+namespace symbol_perfect_hash {
+
+inline constexpr uint32_t kNumSymbols = 1434;
+inline constexpr uint32_t kNumBuckets = 358;
+inline constexpr uint32_t kTableSize = 1793;
+
+inline constexpr uint32_t kSeeds[kNumBuckets] = {
+    5, 5, 1, 17, 39, 10, 5, 6, 3, 4, 1, 40,
+    1, 3, 8, 3, 2, 26, 4, 1, 10, 2, 23, 7,
+    16, 30, 3, 1, 4, 1, 3, 64, 16, 4, 3, 5,
+    1, 15, 11, 9, 3, 2, 40, 1, 11, 10, 9, 4,
+    9, 19, 1, 6, 6, 6, 8, 7, 2, 3, 5, 11,
+    6, 23, 9, 1, 1, 83, 15, 7, 2, 3, 1, 3,
+    14, 17, 4, 1, 1, 10, 2, 10, 4, 2, 12, 5,
+    44, 5, 3, 27, 61, 13, 2, 4, 3, 12, 8, 4,
+    15, 36, 1, 6, 5, 1, 27, 2, 25, 2, 1, 5,
+    4, 3, 33, 41, 2, 3, 3, 44, 5, 19, 1, 5,
+    20, 14, 4, 1, 1, 2, 7, 34, 4, 12, 3, 7,
+    33, 10, 1, 4, 34, 2, 8, 10, 11, 0, 19, 4,
+    2, 1, 2, 4, 5, 0, 28, 7, 7, 63, 24, 40,
+    12, 7, 20, 1, 12, 22, 71, 4, 9, 7, 1, 1,
+    2, 1, 1, 42, 7, 32, 1, 78, 6, 1, 1, 7,
+    5, 2, 4, 13, 50, 9, 8, 3, 21, 2, 1, 73,
+    1, 9, 8, 48, 20, 14, 6, 16, 48, 21, 1, 11,
+    16, 1, 57, 43, 7, 4, 3, 67, 32, 24, 14, 3,
+    1, 19, 39, 15, 2, 5, 15, 5, 22, 2, 6, 36,
+    9, 2, 39, 36, 30, 43, 17, 15, 17, 51, 7, 30,
+    41, 5, 3, 56, 16, 1, 4, 1, 0, 1, 18, 22,
+    5, 9, 3, 12, 2, 1, 1, 80, 0, 8, 1, 3,
+    7, 1, 1, 5, 9, 5, 2, 16, 27, 47, 8, 1,
+    4, 1, 52, 10, 29, 2, 13, 2, 1, 3, 36, 2,
+    8, 16, 51, 1, 2, 49, 6, 34, 1, 13, 41, 2,
+    29, 21, 9, 17, 6, 13, 7, 127, 25, 7, 4, 5,
+    12, 9, 58, 1, 13, 42, 30, 98, 1, 64, 4, 0,
+    5, 65, 9, 47, 7, 39, 2, 7, 13, 10, 9, 29,
+    8, 7, 13, 4, 23, 2, 32, 5, 0, 15, 78, 3,
+    21, 2, 4, 65, 9, 4, 22, 5, 48, 49,
+};
+
+inline constexpr PerfectHashEntry kTable[kTableSize] = {
+    {{0x535544464d4f5441ULL, 0x44ULL}, 148}, // ATOMFDUSD
+    {{0x544453554d4c47ULL, 0x0ULL}, 539}, // GLMUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535554424e42ULL, 0x0ULL}, 256}, // BNBTUSD
+    {{0x59504a545041ULL, 0x0ULL}, 107}, // APTJPY
+    {{0x43445355544341ULL, 0x0ULL}, 35}, // ACTUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355504c53ULL, 0x0ULL}, 1116}, // SLPUSDT
+    {{0x4354425a5458ULL, 0x0ULL}, 1395}, // XTZBTC
+    {{0x424e42495553ULL, 0x0ULL}, 1170}, // SUIBNB
+    {{0x544453554e474953ULL, 0x0ULL}, 1106}, // SIGNUSDT
+    {{0x4453554954524150ULL, 0x54ULL}, 905}, // PARTIUSDT
+    {{0x595254585254ULL, 0x0ULL}, 1256}, // TRXTRY
+    {{0x59504a42494853ULL, 0x0ULL}, 1098}, // SHIBJPY
+    {{0x54445355434e4bULL, 0x0ULL}, 693}, // KNCUSDT
+    {{0x54445355414441ULL, 0x0ULL}, 50}, // ADAUSDT
+    {{0x424e42544546ULL, 0x0ULL}, 487}, // FETBNB
+    {{0x59504a495553ULL, 0x0ULL}, 1175}, // SUIJPY
+    {{0x59525456554aULL, 0x0ULL}, 667}, // JUVTRY
+    {{0x435442444e4153ULL, 0x0ULL}, 1058}, // SANDBTC
+    {{0x54445355584349ULL, 0x0ULL}, 613}, // ICXUSDT
+    {{0x435442435445ULL, 0x0ULL}, 454}, // ETCBTC
+    {{0x4354424b4e494cULL, 0x0ULL}, 714}, // LINKBTC
+    {{0x5444535550464eULL, 0x0ULL}, 832}, // NFPUSDT
+    {{0x595254504c53ULL, 0x0ULL}, 1115}, // SLPTRY
+    {{0x5444535554584fULL, 0x0ULL}, 900}, // OXTUSDT
+    {{0x59525449544f43ULL, 0x0ULL}, 339}, // COTITRY
+    {{0x435442414d55ULL, 0x0ULL}, 1274}, // UMABTC
+    {{0x4453554f49445541ULL, 0x54ULL}, 159}, // AUDIOUSDT
+    {{0x525545444c4745ULL, 0x0ULL}, 418}, // EGLDEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355544341ULL, 0x0ULL}, 36}, // ACTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355434b51ULL, 0x0ULL}, 988}, // QKCUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355524b4dULL, 0x0ULL}, 793}, // MKRUSDC
+    {{0x55454d4954474942ULL, 0x434453ULL}, 233}, // BIGTIMEUSDC
+    {{0x44535544464f525aULL, 0x0ULL}, 1428}, // ZROFDUSD
+    {{0x535544464d4b5241ULL, 0x44ULL}, 125}, // ARKMFDUSD
+    {{0x485445475658ULL, 0x0ULL}, 1399}, // XVGETH
+    {{0x544c415554524956ULL, 0x5952ULL}, 1326}, // VIRTUALTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554c4f53ULL, 0x0ULL}, 1132}, // SOLUSDT
+    {{0x54445355454e5552ULL, 0x0ULL}, 1048}, // RUNEUSDT
+    {{0x544453554f4946ULL, 0x0ULL}, 503}, // FIOUSDT
+    {{0x5544464946485445ULL, 0x4453ULL}, 466}, // ETHFIFDUSD
+    {{0x44535544464f49ULL, 0x0ULL}, 638}, // IOFDUSD
+    {{0x424e42545853ULL, 0x0ULL}, 1192}, // SXTBNB
+    {{0x43544241544e414dULL, 0x0ULL}, 764}, // MANTABTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525445534f52ULL, 0x0ULL}, 1037}, // ROSETRY
+    {{0x53554446414c4147ULL, 0x44ULL}, 528}, // GALAFDUSD
+    {{0x595254414d55ULL, 0x0ULL}, 1275}, // UMATRY
+    {{0x435442414e414dULL, 0x0ULL}, 760}, // MANABTC
+    {{0x544453554e455aULL, 0x0ULL}, 1417}, // ZENUSDT
+    {{0x424e42494553ULL, 0x0ULL}, 1076}, // SEIBNB
+    {{0x59504a494553ULL, 0x0ULL}, 1079}, // SEIJPY
+    {{0x5952544c494eULL, 0x0ULL}, 835}, // NILTRY
+    {{0x5355414e414e4142ULL, 0x4344ULL}, 196}, // BANANAUSDC
+    {{0x59525449544143ULL, 0x0ULL}, 301}, // CATITRY
+    {{0x53554446444e4153ULL, 0x44ULL}, 1059}, // SANDFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e42444c4745ULL, 0x0ULL}, 415}, // EGLDBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544c4946ULL, 0x0ULL}, 499}, // FILTRY
+    {{0x4453555254534d48ULL, 0x54ULL}, 595}, // HMSTRUSDT
+    {{0x544453554449ULL, 0x0ULL}, 619}, // IDUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x53555245444e4552ULL, 0x4344ULL}, 1020}, // RENDERUSDC
+    {{0x55454d4954474942ULL, 0x544453ULL}, 234}, // BIGTIMEUSDT
+    {{0x43544253ULL, 0x0ULL}, 1067}, // SBTC
+    {{0x424e42535841ULL, 0x0ULL}, 176}, // AXSBNB
+    {{0x525545485445ULL, 0x0ULL}, 463}, // ETHEUR
+    {{0x5444535543544cULL, 0x0ULL}, 748}, // LTCUSDT
+    {{0x595254414e414dULL, 0x0ULL}, 762}, // MANATRY
+    {{0x4354424c4b53ULL, 0x0ULL}, 1107}, // SKLBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544248545950ULL, 0x0ULL}, 982}, // PYTHBTC
+    {{0x424e424d4b5241ULL, 0x0ULL}, 123}, // ARKMBNB
+    {{0x485445435445ULL, 0x0ULL}, 455}, // ETCETH
+    {{0x424e4245564f4dULL, 0x0ULL}, 796}, // MOVEBNB
+    {{0x424e42414441ULL, 0x0ULL}, 41}, // ADABNB
+    {{0x595254534954454dULL, 0x0ULL}, 784}, // METISTRY
+    {{0x544453554f4f57ULL, 0x0ULL}, 1364}, // WOOUSDT
+    {{0x424e4253ULL, 0x0ULL}, 1066}, // SBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453555353454843ULL, 0x54ULL}, 318}, // CHESSUSDT
+    {{0x5444535550584157ULL, 0x0ULL}, 1335}, // WAXPUSDT
+    {{0x485445585254ULL, 0x0ULL}, 1253}, // TRXETH
+    {{0x4c5242544f44ULL, 0x0ULL}, 394}, // DOTBRL
+    {{0x54445355535658ULL, 0x0ULL}, 1405}, // XVSUSDT
+    {{0x49414454445355ULL, 0x0ULL}, 1293}, // USDTDAI
+    {{0x43445355544d42ULL, 0x0ULL}, 246}, // BMTUSDC
+    {{0x54445355475658ULL, 0x0ULL}, 1401}, // XVGUSDT
+    {{0x5355444642494853ULL, 0x44ULL}, 1097}, // SHIBFDUSD
+    {{0x43544254534aULL, 0x0ULL}, 657}, // JSTBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442584441ULL, 0x0ULL}, 51}, // ADXBTC
+    {{0x59525445474f44ULL, 0x0ULL}, 385}, // DOGETRY
+    {{0x54445355524142ULL, 0x0ULL}, 201}, // BARUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254544e4544ULL, 0x0ULL}, 370}, // DENTTRY
+    {{0x4453554446435442ULL, 0x0ULL}, 281}, // BTCFDUSD
+    {{0x435442475453ULL, 0x0ULL}, 1146}, // STGBTC
+    {{0x424e42535047ULL, 0x0ULL}, 549}, // GPSBNB
+    {{0x43544245564f4dULL, 0x0ULL}, 797}, // MOVEBTC
+    {{0x43544249535443ULL, 0x0ULL}, 351}, // CTSIBTC
+    {{0x5444535543545442ULL, 0x0ULL}, 293}, // BTTCUSDT
+    {{0x4344535542494853ULL, 0x0ULL}, 1100}, // SHIBUSDC
+    {{0x4453554b43495551ULL, 0x54ULL}, 996}, // QUICKUSDT
+    {{0x5355444652534e54ULL, 0x44ULL}, 1230}, // TNSRFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544241444946ULL, 0x0ULL}, 493}, // FIDABTC
+    {{0x59504a414441ULL, 0x0ULL}, 47}, // ADAJPY
+    {{0x4453555055525953ULL, 0x43ULL}, 1200}, // SYRUPUSDC
+    {{0x4854455245425943ULL, 0x0ULL}, 358}, // CYBERETH
+    {{0x544453554f58454eULL, 0x0ULL}, 828}, // NEXOUSDT
+    {{0x4344535553ULL, 0x0ULL}, 1184}, // SUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355535953ULL, 0x0ULL}, 1203}, // SYSUSDT
+    {{0x59525443445355ULL, 0x0ULL}, 1287}, // USDCTRY
+    {{0x44535544464c4f50ULL, 0x0ULL}, 956}, // POLFDUSD
+    {{0x4453554854454257ULL, 0x54ULL}, 1337}, // WBETHUSDT
+    {{0x4854454c4f53ULL, 0x0ULL}, 1124}, // SOLETH
+    {{0x54445355524c4543ULL, 0x0ULL}, 307}, // CELRUSDT
+    {{0x4e424c4154524f50ULL, 0x42ULL}, 965}, // PORTALBNB
+    {{0x595254575342ULL, 0x0ULL}, 274}, // BSWTRY
+    {{0x424e4254504cULL, 0x0ULL}, 728}, // LPTBNB
+    {{0x5444535545504550ULL, 0x0ULL}, 930}, // PEPEUSDT
+    {{0x5355444648545950ULL, 0x44ULL}, 983}, // PYTHFDUSD
+    {{0x5544464154454854ULL, 0x4453ULL}, 1213}, // THETAFDUSD
+    {{0x54445355444c4741ULL, 0x0ULL}, 60}, // AGLDUSDT
+    {{0x44464c4144454148ULL, 0x445355ULL}, 569}, // HAEDALFDUSD
+    {{0x54445355524d4c47ULL, 0x0ULL}, 538}, // GLMRUSDT
+    {{0x544453554c4b53ULL, 0x0ULL}, 1109}, // SKLUSDT
+    {{0x595254584643ULL, 0x0ULL}, 312}, // CFXTRY
+    {{0x595254454dULL, 0x0ULL}, 786}, // METRY
+    {{0x4453554954524150ULL, 0x43ULL}, 904}, // PARTIUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355495553ULL, 0x0ULL}, 1178}, // SUIUSDT
+    {{0x48544545564141ULL, 0x0ULL}, 18}, // AAVEETH
+    {{0x5355444658454449ULL, 0x44ULL}, 615}, // IDEXFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535555474e4550ULL, 0x43ULL}, 917}, // PENGUUSDC
+    {{0x445355444643544cULL, 0x0ULL}, 744}, // LTCFDUSD
+    {{0x5952545a4843ULL, 0x0ULL}, 323}, // CHZTRY
+    {{0x4354425245505553ULL, 0x0ULL}, 1181}, // SUPERBTC
+    {{0x4453554446424e42ULL, 0x0ULL}, 253}, // BNBFDUSD
+    {{0x544453555a4552ULL, 0x0ULL}, 1026}, // REZUSDT
+    {{0x4c524245474f44ULL, 0x0ULL}, 380}, // DOGEBRL
+    {{0x54445355425254ULL, 0x0ULL}, 1242}, // TRBUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535558594c4f50ULL, 0x54ULL}, 963}, // POLYXUSDT
+    {{0x4453554948535553ULL, 0x54ULL}, 1188}, // SUSHIUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355435445ULL, 0x0ULL}, 458}, // ETCUSDT
+    {{0x485445544e4544ULL, 0x0ULL}, 369}, // DENTETH
+    {{0x54445355474759ULL, 0x0ULL}, 1411}, // YGGUSDT
+    {{0x595254474759ULL, 0x0ULL}, 1409}, // YGGTRY
+    {{0x59525443544cULL, 0x0ULL}, 746}, // LTCTRY
+    {{0x43544252545341ULL, 0x0ULL}, 139}, // ASTRBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525442494853ULL, 0x0ULL}, 1099}, // SHIBTRY
+    {{0x54445355565353ULL, 0x0ULL}, 1141}, // SSVUSDT
+    {{0x4344535545564f4dULL, 0x0ULL}, 800}, // MOVEUSDC
+    {{0x4453554446495553ULL, 0x0ULL}, 1174}, // SUIFDUSD
+    {{0x59525441494d554cULL, 0x0ULL}, 751}, // LUMIATRY
+    {{0x4854454d555451ULL, 0x0ULL}, 993}, // QTUMETH
+    {{0x48544553ULL, 0x0ULL}, 1083}, // SETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442584e53ULL, 0x0ULL}, 1117}, // SNXBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535544464242ULL, 0x0ULL}, 206}, // BBFDUSD
+    {{0x54445355455741ULL, 0x0ULL}, 172}, // AWEUSDT
+    {{0x5952544f54524f50ULL, 0x0ULL}, 970}, // PORTOTRY
+    {{0x595254584d414542ULL, 0x0ULL}, 218}, // BEAMXTRY
+    {{0x4453554c41555355ULL, 0x43ULL}, 1304}, // USUALUSDC
+    {{0x5852544e4957ULL, 0x0ULL}, 1356}, // WINTRX
+    {{0x43445355454854ULL, 0x0ULL}, 1218}, // THEUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952545245505553ULL, 0x0ULL}, 1182}, // SUPERTRY
+    {{0x544453554b4f4f48ULL, 0x0ULL}, 596}, // HOOKUSDT
+    {{0x5444535558445944ULL, 0x0ULL}, 410}, // DYDXUSDT
+    {{0x4354424449ULL, 0x0ULL}, 614}, // IDBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f474544ULL, 0x0ULL}, 368}, // DEGOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5544464954524150ULL, 0x4453ULL}, 902}, // PARTIFDUSD
+    {{0x5952544e45474945ULL, 0x0ULL}, 426}, // EIGENTRY
+    {{0x43445355435643ULL, 0x0ULL}, 353}, // CVCUSDC
+    {{0x4453554f5249454eULL, 0x54ULL}, 822}, // NEIROUSDT
+    {{0x54445355584441ULL, 0x0ULL}, 53}, // ADXUSDT
+    {{0x435442535841ULL, 0x0ULL}, 177}, // AXSBTC
+    {{0x43445355585254ULL, 0x0ULL}, 1257}, // TRXUSDC
+    {{0x53554446564c4f53ULL, 0x44ULL}, 1134}, // SOLVFDUSD
+    {{0x4453554f42525554ULL, 0x43ULL}, 1265}, // TURBOUSDC
+    {{0x43544258525aULL, 0x0ULL}, 1432}, // ZRXBTC
+    {{0x595254424850ULL, 0x0ULL}, 937}, // PHBTRY
+    {{0x4354424c5841ULL, 0x0ULL}, 173}, // AXLBTC
+    {{0x54445355444e4142ULL, 0x0ULL}, 199}, // BANDUSDT
+    {{0x43544241444bULL, 0x0ULL}, 681}, // KDABTC
+    {{0x54445355585254ULL, 0x0ULL}, 1258}, // TRXUSDT
+    {{0x4453554446444c57ULL, 0x0ULL}, 1360}, // WLDFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554941ULL, 0x0ULL}, 65}, // AIUSDT
+    {{0x5444535533495041ULL, 0x0ULL}, 102}, // API3USDT
+    {{0x59504a43544cULL, 0x0ULL}, 745}, // LTCJPY
+    {{0x525545425241ULL, 0x0ULL}, 113}, // ARBEUR
+    {{0x4e584d485445ULL, 0x0ULL}, 471}, // ETHMXN
+    {{0x544453554e5547ULL, 0x0ULL}, 566}, // GUNUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545545247ULL, 0x0ULL}, 556}, // GRTEUR
+    {{0x54445355505258ULL, 0x0ULL}, 1394}, // XRPUSDT
+    {{0x54445355414e45ULL, 0x0ULL}, 435}, // ENAUSDT
+    {{0x554446504d555254ULL, 0x4453ULL}, 1245}, // TRUMPFDUSD
+    {{0x5952545a4552ULL, 0x0ULL}, 1024}, // REZTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442414c4147ULL, 0x0ULL}, 525}, // GALABTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554e45474945ULL, 0x54ULL}, 428}, // EIGENUSDT
+    {{0x5354415330303031ULL, 0x595254ULL}, 8}, // 1000SATSTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x49525545485445ULL, 0x0ULL}, 464}, // ETHEURI
+    {{0x5444535556414dULL, 0x0ULL}, 773}, // MAVUSDT
+    {{0x53554c454e52454bULL, 0x5444ULL}, 687}, // KERNELUSDT
+    {{0x544453554e474fULL, 0x0ULL}, 857}, // OGNUSDT
+    {{0x595254524b4dULL, 0x0ULL}, 792}, // MKRTRY
+    {{0x59525452554c42ULL, 0x0ULL}, 240}, // BLURTRY
+    {{0x4d4f52444f4c4556ULL, 0x5444535545ULL}, 1316}, // VELODROMEUSDT
+    {{0x5354415330303031ULL, 0x4453554446ULL}, 7}, // 1000SATSFDUSD
+    {{0x4354424242ULL, 0x0ULL}, 205}, // BBBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x52554554554e50ULL, 0x0ULL}, 946}, // PNUTEUR
+    {{0x435442534147ULL, 0x0ULL}, 532}, // GASBTC
+    {{0x43445355544d47ULL, 0x0ULL}, 543}, // GMTUSDC
+    {{0x4453554446485445ULL, 0x0ULL}, 465}, // ETHFDUSD
+    {{0x43445355414954ULL, 0x0ULL}, 1223}, // TIAUSDC
+    {{0x4344535545524152ULL, 0x0ULL}, 1001}, // RAREUSDC
+    {{0x434453554c4f50ULL, 0x0ULL}, 959}, // POLUSDC
+    {{0x5444535544535554ULL, 0x0ULL}, 1269}, // TUSDUSDT
+    {{0x43544247584150ULL, 0x0ULL}, 906}, // PAXGBTC
+    {{0x4e4c50435442ULL, 0x0ULL}, 284}, // BTCPLN
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x48544558415641ULL, 0x0ULL}, 165}, // AVAXETH
+    {{0x5952544a4e49ULL, 0x0ULL}, 633}, // INJTRY
+    {{0x4453554446494e55ULL, 0x0ULL}, 1279}, // UNIFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e42505258ULL, 0x0ULL}, 1383}, // XRPBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442425254ULL, 0x0ULL}, 1239}, // TRBBTC
+    {{0x544453554c494eULL, 0x0ULL}, 837}, // NILUSDT
+    {{0x54445355545354ULL, 0x0ULL}, 1263}, // TSTUSDT
+    {{0x4354424948535553ULL, 0x0ULL}, 1186}, // SUSHIBTC
+    {{0x5952544b53414dULL, 0x0ULL}, 769}, // MASKTRY
+    {{0x5355454c444e4550ULL, 0x4344ULL}, 913}, // PENDLEUSDC
+    {{0x43445355544f44ULL, 0x0ULL}, 400}, // DOTUSDC
+    {{0x43544252564f4dULL, 0x0ULL}, 802}, // MOVRBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554e4957ULL, 0x0ULL}, 1357}, // WINUSDT
+    {{0x525545484342ULL, 0x0ULL}, 212}, // BCHEUR
+    {{0x43445355474759ULL, 0x0ULL}, 1410}, // YGGUSDC
+    {{0x59525459524e4156ULL, 0x0ULL}, 1312}, // VANRYTRY
+    {{0x52415a435442ULL, 0x0ULL}, 291}, // BTCZAR
+    {{0x5355444658415641ULL, 0x44ULL}, 167}, // AVAXFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535549544143ULL, 0x0ULL}, 302}, // CATIUSDC
+    {{0x445355594d53414aULL, 0x54ULL}, 654}, // JASMYUSDT
+    {{0x434453554d4b5241ULL, 0x0ULL}, 127}, // ARKMUSDC
+    {{0x434453554f49ULL, 0x0ULL}, 650}, // IOUSDC
+    {{0x544453554c4946ULL, 0x0ULL}, 501}, // FILUSDT
+    {{0x435442414441ULL, 0x0ULL}, 43}, // ADABTC
+    {{0x434453554f525aULL, 0x0ULL}, 1430}, // ZROUSDC
+    {{0x544453554e4157ULL, 0x0ULL}, 1333}, // WANUSDT
+    {{0x595254544f4eULL, 0x0ULL}, 843}, // NOTTRY
+    {{0x5444535558544f49ULL, 0x0ULL}, 649}, // IOTXUSDT
+    {{0x4c5242464957ULL, 0x0ULL}, 1348}, // WIFBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254414850ULL, 0x0ULL}, 933}, // PHATRY
+    {{0x435442504fULL, 0x0ULL}, 881}, // OPBTC
+    {{0x4c52424f5449414bULL, 0x0ULL}, 673}, // KAITOBRL
+    {{0x4453554453554446ULL, 0x54ULL}, 486}, // FDUSDUSDT
+    {{0x54445355434558ULL, 0x0ULL}, 1372}, // XECUSDT
+    {{0x54445355535841ULL, 0x0ULL}, 180}, // AXSUSDT
+    {{0x54445355524843ULL, 0x0ULL}, 320}, // CHRUSDT
+    {{0x544453554644ULL, 0x0ULL}, 374}, // DFUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544258445944ULL, 0x0ULL}, 406}, // DYDXBTC
+    {{0x4446454c504f4550ULL, 0x445355ULL}, 920}, // PEOPLEFDUSD
+    {{0x54445355545754ULL, 0x0ULL}, 1273}, // TWTUSDT
+    {{0x424e425241454eULL, 0x0ULL}, 809}, // NEARBNB
+    {{0x59525459544943ULL, 0x0ULL}, 326}, // CITYTRY
+    {{0x43445355454b4143ULL, 0x0ULL}, 298}, // CAKEUSDC
+    {{0x525545424e42ULL, 0x0ULL}, 252}, // BNBEUR
+    {{0x424e42435445ULL, 0x0ULL}, 453}, // ETCBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254414e4156ULL, 0x0ULL}, 1309}, // VANATRY
+    {{0x4c5242414441ULL, 0x0ULL}, 42}, // ADABRL
+    {{0x5254534f544e4153ULL, 0x59ULL}, 1064}, // SANTOSTRY
+    {{0x4c52424c4f50ULL, 0x0ULL}, 952}, // POLBRL
+    {{0x595254545041ULL, 0x0ULL}, 108}, // APTTRY
+    {{0x595254545354ULL, 0x0ULL}, 1261}, // TSTTRY
+    {{0x435442414850ULL, 0x0ULL}, 932}, // PHABTC
+    {{0x5444535554524353ULL, 0x0ULL}, 1073}, // SCRTUSDT
+    {{0x5444535554504cULL, 0x0ULL}, 731}, // LPTUSDT
+    {{0x54445355454d454dULL, 0x0ULL}, 783}, // MEMEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445444c4745ULL, 0x0ULL}, 417}, // EGLDETH
+    {{0x44535544464941ULL, 0x0ULL}, 63}, // AIFDUSD
+    {{0x4453554c45584950ULL, 0x43ULL}, 942}, // PIXELUSDC
+    {{0x525545504d555254ULL, 0x0ULL}, 1244}, // TRUMPEUR
+    {{0x49525545435442ULL, 0x0ULL}, 280}, // BTCEURI
+    {{0x544453554f544aULL, 0x0ULL}, 662}, // JTOUSDT
+    {{0x54445355444552ULL, 0x0ULL}, 1013}, // REDUSDT
+    {{0x595254524142ULL, 0x0ULL}, 200}, // BARTRY
+    {{0x434453554350584eULL, 0x0ULL}, 852}, // NXPCUSDC
+    {{0x54445355435447ULL, 0x0ULL}, 560}, // GTCUSDT
+    {{0x4354425841525453ULL, 0x0ULL}, 1156}, // STRAXBTC
+    {{0x435442584349ULL, 0x0ULL}, 612}, // ICXBTC
+    {{0x5255455241454eULL, 0x0ULL}, 813}, // NEAREUR
+    {{0x4344535545564948ULL, 0x0ULL}, 590}, // HIVEUSDC
+    {{0x4354424f4154ULL, 0x0ULL}, 1204}, // TAOBTC
+    {{0x44535544465241ULL, 0x0ULL}, 122}, // ARFDUSD
+    {{0x544453554f4c4543ULL, 0x0ULL}, 306}, // CELOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5355454c444e4550ULL, 0x5444ULL}, 914}, // PENDLEUSDT
+    {{0x424e4259424142ULL, 0x0ULL}, 181}, // BABYBNB
+    {{0x54445355415641ULL, 0x0ULL}, 161}, // AVAUSDT
+    {{0x424e42544c41ULL, 0x0ULL}, 79}, // ALTBNB
+    {{0x435442565243ULL, 0x0ULL}, 344}, // CRVBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f4e58ULL, 0x0ULL}, 1382}, // XNOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554543494c41ULL, 0x54ULL}, 75}, // ALICEUSDT
+    {{0x48544543544cULL, 0x0ULL}, 742}, // LTCETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952545241454eULL, 0x0ULL}, 816}, // NEARTRY
+    {{0x4354424d4c47ULL, 0x0ULL}, 536}, // GLMBTC
+    {{0x4453554446494553ULL, 0x0ULL}, 1078}, // SEIFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355585643ULL, 0x0ULL}, 355}, // CVXUSDT
+    {{0x445355434947414dULL, 0x54ULL}, 759}, // MAGICUSDT
+    {{0x4354424e4f54ULL, 0x0ULL}, 1234}, // TONBTC
+    {{0x4354424c4542ULL, 0x0ULL}, 221}, // BELBTC
+    {{0x544453554e4f54ULL, 0x0ULL}, 1238}, // TONUSDT
+    {{0x434453554e4f54ULL, 0x0ULL}, 1237}, // TONUSDC
+    {{0x435442444c57ULL, 0x0ULL}, 1358}, // WLDBTC
+    {{0x595254554445ULL, 0x0ULL}, 413}, // EDUTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424a524f5453ULL, 0x0ULL}, 1150}, // STORJBTC
+    {{0x4354424f474c41ULL, 0x0ULL}, 70}, // ALGOBTC
+    {{0x445355504d555254ULL, 0x43ULL}, 1247}, // TRUMPUSDC
+    {{0x424e4241524542ULL, 0x0ULL}, 224}, // BERABNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545544f44ULL, 0x0ULL}, 397}, // DOTEUR
+    {{0x4453554f5449414bULL, 0x43ULL}, 677}, // KAITOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554f5453ULL, 0x0ULL}, 1154}, // STOUSDC
+    {{0x59504a5241454eULL, 0x0ULL}, 815}, // NEARJPY
+    {{0x44535554485445ULL, 0x0ULL}, 474}, // ETHTUSD
+    {{0x434453554c4f53ULL, 0x0ULL}, 1131}, // SOLUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544941ULL, 0x0ULL}, 64}, // AITRY
+    {{0x43445355425254ULL, 0x0ULL}, 1241}, // TRBUSDC
+    {{0x4453554446544341ULL, 0x0ULL}, 33}, // ACTFDUSD
+    {{0x5952544e5553ULL, 0x0ULL}, 1179}, // SUNTRY
+    {{0x595254424e42ULL, 0x0ULL}, 255}, // BNBTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544b4e4f42ULL, 0x0ULL}, 269}, // BONKTRY
+    {{0x59525448545950ULL, 0x0ULL}, 984}, // PYTHTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554c4542ULL, 0x0ULL}, 223}, // BELUSDT
+    {{0x424e424b5443ULL, 0x0ULL}, 348}, // CTKBNB
+    {{0x43445355464957ULL, 0x0ULL}, 1353}, // WIFUSDC
+    {{0x53554c4154524f50ULL, 0x5444ULL}, 969}, // PORTALUSDT
+    {{0x595254504349ULL, 0x0ULL}, 609}, // ICPTRY
+    {{0x54445355454b4143ULL, 0x0ULL}, 299}, // CAKEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525458415641ULL, 0x0ULL}, 168}, // AVAXTRY
+    {{0x595254534147ULL, 0x0ULL}, 533}, // GASTRY
+    {{0x43445355494553ULL, 0x0ULL}, 1081}, // SEIUSDC
+    {{0x435442534f45ULL, 0x0ULL}, 445}, // EOSBTC
+    {{0x43544248434e4931ULL, 0x0ULL}, 11}, // 1INCHBTC
+    {{0x54445355444e4153ULL, 0x0ULL}, 1062}, // SANDUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x554446524559414cULL, 0x4453ULL}, 699}, // LAYERFDUSD
+    {{0x535544464b4e4f42ULL, 0x44ULL}, 268}, // BONKFDUSD
+    {{0x59525447ULL, 0x0ULL}, 561}, // GTRY
+    {{0x544453554d4c46ULL, 0x0ULL}, 507}, // FLMUSDT
+    {{0x435442444c4741ULL, 0x0ULL}, 59}, // AGLDBTC
+    {{0x4453554946485445ULL, 0x54ULL}, 469}, // ETHFIUSDT
+    {{0x4354424154454854ULL, 0x0ULL}, 1212}, // THETABTC
+    {{0x544453554b53414dULL, 0x0ULL}, 770}, // MASKUSDT
+    {{0x4344535558415641ULL, 0x0ULL}, 169}, // AVAXUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446454dULL, 0x0ULL}, 779}, // MEFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535548534144ULL, 0x0ULL}, 364}, // DASHUSDT
+    {{0x43445355505258ULL, 0x0ULL}, 1393}, // XRPUSDC
+    {{0x5952545245505948ULL, 0x0ULL}, 602}, // HYPERTRY
+    {{0x44535544464c4946ULL, 0x0ULL}, 498}, // FILFDUSD
+    {{0x544453554b4e494cULL, 0x0ULL}, 721}, // LINKUSDT
+    {{0x5444535558525aULL, 0x0ULL}, 1433}, // ZRXUSDT
+    {{0x5254414e414e4142ULL, 0x59ULL}, 195}, // BANANATRY
+    {{0x54445355544e4fULL, 0x0ULL}, 880}, // ONTUSDT
+    {{0x5544464f5449414bULL, 0x4453ULL}, 675}, // KAITOFDUSD
+    {{0x544453554e4c4dULL, 0x0ULL}, 795}, // MLNUSDT
+    {{0x44535544464d4c54ULL, 0x0ULL}, 1226}, // TLMFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e42414e45ULL, 0x0ULL}, 429}, // ENABNB
+    {{0x4453554446585453ULL, 0x0ULL}, 1166}, // STXFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535544464f4154ULL, 0x0ULL}, 1205}, // TAOFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x52554545504550ULL, 0x0ULL}, 925}, // PEPEEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544c4b53ULL, 0x0ULL}, 1108}, // SKLTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442544f44ULL, 0x0ULL}, 395}, // DOTBTC
+    {{0x54445355504d4f43ULL, 0x0ULL}, 333}, // COMPUSDT
+    {{0x434453555a4552ULL, 0x0ULL}, 1025}, // REZUSDC
+    {{0x5444535554504743ULL, 0x0ULL}, 316}, // CGPTUSDT
+    {{0x4354424d4c58ULL, 0x0ULL}, 1373}, // XLMBTC
+    {{0x43445355464c53ULL, 0x0ULL}, 1112}, // SLFUSDC
+    {{0x5444535554444dULL, 0x0ULL}, 777}, // MDTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545585254ULL, 0x0ULL}, 1254}, // TRXEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59504a4b4e494cULL, 0x0ULL}, 718}, // LINKJPY
+    {{0x4e4c5054445355ULL, 0x0ULL}, 1295}, // USDTPLN
+    {{0x59525453474f44ULL, 0x0ULL}, 390}, // DOGSTRY
+    {{0x434453554b525453ULL, 0x0ULL}, 1161}, // STRKUSDC
+    {{0x5952544d524f46ULL, 0x0ULL}, 516}, // FORMTRY
+    {{0x5444535543544257ULL, 0x0ULL}, 1341}, // WBTCUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446484342ULL, 0x0ULL}, 213}, // BCHFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535550445355ULL, 0x0ULL}, 1289}, // USDPUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545544556ULL, 0x0ULL}, 1320}, // VETEUR
+    {{0x59525452534e54ULL, 0x0ULL}, 1231}, // TNSRTRY
+    {{0x424e42544d42ULL, 0x0ULL}, 243}, // BMTBNB
+    {{0x4f44594241424d31ULL, 0x544453554547ULL}, 16}, // 1MBABYDOGEUSDT
+    {{0x54445355475350ULL, 0x0ULL}, 977}, // PSGUSDT
+    {{0x43544245524152ULL, 0x0ULL}, 999}, // RAREBTC
+    {{0x424e42544357ULL, 0x0ULL}, 1342}, // WCTBNB
+    {{0x54445355434c52ULL, 0x0ULL}, 1031}, // RLCUSDT
+    {{0x595254484342ULL, 0x0ULL}, 215}, // BCHTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535552554c42ULL, 0x0ULL}, 241}, // BLURUSDC
+    {{0x5444535548545950ULL, 0x0ULL}, 986}, // PYTHUSDT
+    {{0x5952544350584eULL, 0x0ULL}, 851}, // NXPCTRY
+    {{0x424e424e5547ULL, 0x0ULL}, 562}, // GUNBNB
+    {{0x4344535541544f49ULL, 0x0ULL}, 643}, // IOTAUSDC
+    {{0x4354424c45554654ULL, 0x0ULL}, 1209}, // TFUELBTC
+    {{0x5254454e49504c41ULL, 0x59ULL}, 77}, // ALPINETRY
+    {{0x434453554f4154ULL, 0x0ULL}, 1207}, // TAOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453555241454eULL, 0x0ULL}, 817}, // NEARUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544258594c4f50ULL, 0x0ULL}, 961}, // POLYXBTC
+    {{0x434453554a4e45ULL, 0x0ULL}, 438}, // ENJUSDC
+    {{0x4453554446544546ULL, 0x0ULL}, 489}, // FETFDUSD
+    {{0x4e584d505258ULL, 0x0ULL}, 1390}, // XRPMXN
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5544464c41555355ULL, 0x4453ULL}, 1302}, // USUALFDUSD
+    {{0x434453554f4e4d4bULL, 0x0ULL}, 690}, // KMNOUSDC
+    {{0x595254565243ULL, 0x0ULL}, 345}, // CRVTRY
+    {{0x4453554e494e4f52ULL, 0x54ULL}, 1035}, // RONINUSDT
+    {{0x5952544c4f50ULL, 0x0ULL}, 958}, // POLTRY
+    {{0x54445355444e4f50ULL, 0x0ULL}, 964}, // PONDUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535544464a4e49ULL, 0x0ULL}, 632}, // INJFDUSD
+    {{0x59504a485445ULL, 0x0ULL}, 470}, // ETHJPY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544c4f53ULL, 0x0ULL}, 1129}, // SOLTRY
+    {{0x5444535549535443ULL, 0x0ULL}, 352}, // CTSIUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535545474f44ULL, 0x0ULL}, 387}, // DOGEUSDC
+    {{0x5355444652414248ULL, 0x44ULL}, 575}, // HBARFDUSD
+    {{0x4344535552414248ULL, 0x0ULL}, 577}, // HBARUSDC
+    {{0x544453554242ULL, 0x0ULL}, 209}, // BBUSDT
+    {{0x435442444d4bULL, 0x0ULL}, 688}, // KMDBTC
+    {{0x54445355414341ULL, 0x0ULL}, 24}, // ACAUSDT
+    {{0x4453555442584941ULL, 0x54ULL}, 68}, // AIXBTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x445355524559414cULL, 0x54ULL}, 702}, // LAYERUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554d524f46ULL, 0x0ULL}, 518}, // FORMUSDT
+    {{0x4344535545564141ULL, 0x0ULL}, 21}, // AAVEUSDC
+    {{0x4344535554554e50ULL, 0x0ULL}, 949}, // PNUTUSDC
+    {{0x4453554446544f44ULL, 0x0ULL}, 398}, // DOTFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535545584544ULL, 0x0ULL}, 372}, // DEXEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525457ULL, 0x0ULL}, 1365}, // WTRY
+    {{0x525545544341ULL, 0x0ULL}, 32}, // ACTEUR
+    {{0x54445355544d47ULL, 0x0ULL}, 544}, // GMTUSDT
+    {{0x544453554b5443ULL, 0x0ULL}, 350}, // CTKUSDT
+    {{0x595254544d47ULL, 0x0ULL}, 542}, // GMTTRY
+    {{0x43445355494e4d4fULL, 0x0ULL}, 864}, // OMNIUSDC
+    {{0x54445355444d4bULL, 0x0ULL}, 689}, // KMDUSDT
+    {{0x4453554446505258ULL, 0x0ULL}, 1388}, // XRPFDUSD
+    {{0x59504a4d4c58ULL, 0x0ULL}, 1377}, // XLMJPY
+    {{0x435442524d4c47ULL, 0x0ULL}, 537}, // GLMRBTC
+    {{0x5952544d4c54ULL, 0x0ULL}, 1227}, // TLMTRY
+    {{0x525545414c4147ULL, 0x0ULL}, 527}, // GALAEUR
+    {{0x424e424350584eULL, 0x0ULL}, 849}, // NXPCBNB
+    {{0x54445355524353ULL, 0x0ULL}, 1074}, // SCRUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355574f4c46ULL, 0x0ULL}, 513}, // FLOWUSDT
+    {{0x434453554b5455ULL, 0x0ULL}, 1306}, // UTKUSDC
+    {{0x5355444641524542ULL, 0x44ULL}, 226}, // BERAFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544241544f49ULL, 0x0ULL}, 640}, // IOTABTC
+    {{0x4344535553474f44ULL, 0x0ULL}, 391}, // DOGSUSDC
+    {{0x4453554446494158ULL, 0x0ULL}, 1368}, // XAIFDUSD
+    {{0x595254524b4e41ULL, 0x0ULL}, 92}, // ANKRTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254544e4fULL, 0x0ULL}, 878}, // ONTTRY
+    {{0x5355534f544e4153ULL, 0x5444ULL}, 1065}, // SANTOSUSDT
+    {{0x435442505853ULL, 0x0ULL}, 1189}, // SXPBTC
+    {{0x54445355534e45ULL, 0x0ULL}, 444}, // ENSUSDT
+    {{0x54445355544556ULL, 0x0ULL}, 1323}, // VETUSDT
+    {{0x434453554f544aULL, 0x0ULL}, 661}, // JTOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535549525545ULL, 0x0ULL}, 480}, // EURIUSDT
+    {{0x5444535541544144ULL, 0x0ULL}, 366}, // DATAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442455041ULL, 0x0ULL}, 94}, // APEBTC
+    {{0x595254544c41ULL, 0x0ULL}, 82}, // ALTTRY
+    {{0x554446415453494cULL, 0x4453ULL}, 723}, // LISTAFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5442454c444e4550ULL, 0x43ULL}, 910}, // PENDLEBTC
+    {{0x434453554d4fULL, 0x0ULL}, 867}, // OMUSDC
+    {{0x435442534946ULL, 0x0ULL}, 504}, // FISBTC
+    {{0x4354424e45474945ULL, 0x0ULL}, 424}, // EIGENBTC
+    {{0x4c5242435442ULL, 0x0ULL}, 277}, // BTCBRL
+    {{0x53555849444e5550ULL, 0x5444ULL}, 979}, // PUNDIXUSDT
+    {{0x445355524556454cULL, 0x54ULL}, 711}, // LEVERUSDT
+    {{0x4453554446435445ULL, 0x0ULL}, 456}, // ETCFDUSD
+    {{0x54445355554445ULL, 0x0ULL}, 414}, // EDUUSDT
+    {{0x424e4254494e49ULL, 0x0ULL}, 624}, // INITBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535541524542ULL, 0x0ULL}, 228}, // BERAUSDC
+    {{0x5952544c4c455053ULL, 0x0ULL}, 1137}, // SPELLTRY
+    {{0x44535544464d4c58ULL, 0x0ULL}, 1376}, // XLMFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442504653ULL, 0x0ULL}, 1086}, // SFPBTC
+    {{0x54445355584643ULL, 0x0ULL}, 314}, // CFXUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355424e42ULL, 0x0ULL}, 257}, // BNBUSDC
+    {{0x43445355584643ULL, 0x0ULL}, 313}, // CFXUSDC
+    {{0x4453555245425943ULL, 0x54ULL}, 361}, // CYBERUSDT
+    {{0x5544465254534d48ULL, 0x4453ULL}, 592}, // HMSTRFDUSD
+    {{0x4c524254445355ULL, 0x0ULL}, 1291}, // USDTBRL
+    {{0x5444535550554aULL, 0x0ULL}, 666}, // JUPUSDT
+    {{0x535241485445ULL, 0x0ULL}, 459}, // ETHARS
+    {{0x4354424a4e45ULL, 0x0ULL}, 436}, // ENJBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544453554446ULL, 0x0ULL}, 484}, // FDUSDTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59504a424e42ULL, 0x0ULL}, 254}, // BNBJPY
+    {{0x4354424c4f53ULL, 0x0ULL}, 1123}, // SOLBTC
+    {{0x525545464957ULL, 0x0ULL}, 1350}, // WIFEUR
+    {{0x5544465245425943ULL, 0x4453ULL}, 359}, // CYBERFDUSD
+    {{0x544453554e4b4eULL, 0x0ULL}, 839}, // NKNUSDT
+    {{0x435442584d49ULL, 0x0ULL}, 622}, // IMXBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453555241ULL, 0x0ULL}, 135}, // ARUSDC
+    {{0x54445355535846ULL, 0x0ULL}, 523}, // FXSUSDT
+    {{0x43544245534f52ULL, 0x0ULL}, 1036}, // ROSEBTC
+    {{0x5355444641474153ULL, 0x44ULL}, 1054}, // SAGAFDUSD
+    {{0x4354424d4fULL, 0x0ULL}, 860}, // OMBTC
+    {{0x43544241474153ULL, 0x0ULL}, 1053}, // SAGABTC
+    {{0x544453554f5453ULL, 0x0ULL}, 1155}, // STOUSDT
+    {{0x4b5a4343445355ULL, 0x0ULL}, 1284}, // USDCCZK
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254444152ULL, 0x0ULL}, 997}, // RADTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554c5052ULL, 0x0ULL}, 1040}, // RPLUSDT
+    {{0x54445355424850ULL, 0x0ULL}, 938}, // PHBUSDT
+    {{0x544453554a4e45ULL, 0x0ULL}, 439}, // ENJUSDT
+    {{0x544453554d555451ULL, 0x0ULL}, 995}, // QTUMUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554d4c58ULL, 0x0ULL}, 1379}, // XLMUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535557ULL, 0x0ULL}, 1366}, // WUSDC
+    {{0x54445355474fULL, 0x0ULL}, 859}, // OGUSDT
+    {{0x4344535550554aULL, 0x0ULL}, 665}, // JUPUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442444e4142ULL, 0x0ULL}, 198}, // BANDBTC
+    {{0x435442415641ULL, 0x0ULL}, 160}, // AVABTC
+    {{0x434453554f444e4fULL, 0x0ULL}, 870}, // ONDOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355444552ULL, 0x0ULL}, 1012}, // REDUSDC
+    {{0x435442414e45ULL, 0x0ULL}, 431}, // ENABTC
+    {{0x544453554353ULL, 0x0ULL}, 1075}, // SCUSDT
+    {{0x59525443524cULL, 0x0ULL}, 735}, // LRCTRY
+    {{0x435442524353ULL, 0x0ULL}, 1069}, // SCRBTC
+    {{0x435442574f4c46ULL, 0x0ULL}, 512}, // FLOWBTC
+    {{0x5952544f495a414cULL, 0x0ULL}, 703}, // LAZIOTRY
+    {{0x434453554e5953ULL, 0x0ULL}, 1197}, // SYNUSDC
+    {{0x5444535552445241ULL, 0x0ULL}, 121}, // ARDRUSDT
+    {{0x4f44594241424d31ULL, 0x5952544547ULL}, 14}, // 1MBABYDOGETRY
+    {{0x4354424f5449414bULL, 0x0ULL}, 674}, // KAITOBTC
+    {{0x52544c454e52454bULL, 0x59ULL}, 685}, // KERNELTRY
+    {{0x595254545853ULL, 0x0ULL}, 1194}, // SXTTRY
+    {{0x5952544f544aULL, 0x0ULL}, 660}, // JTOTRY
+    {{0x595254524559414cULL, 0x0ULL}, 700}, // LAYERTRY
+    {{0x485445414c4147ULL, 0x0ULL}, 526}, // GALAETH
+    {{0x485445504fULL, 0x0ULL}, 882}, // OPETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254584341ULL, 0x0ULL}, 38}, // ACXTRY
+    {{0x424e424c4c454853ULL, 0x0ULL}, 1088}, // SHELLBNB
+    {{0x54445355474e4fULL, 0x0ULL}, 876}, // ONGUSDT
+    {{0x554c415554524956ULL, 0x434453ULL}, 1327}, // VIRTUALUSDC
+    {{0x5444535547ULL, 0x0ULL}, 567}, // GUSDT
+    {{0x5444535554554e50ULL, 0x0ULL}, 950}, // PNUTUSDT
+    {{0x43445355414850ULL, 0x0ULL}, 934}, // PHAUSDC
+    {{0x4344535549525545ULL, 0x0ULL}, 479}, // EURIUSDC
+    {{0x5952544d5441ULL, 0x0ULL}, 143}, // ATMTRY
+    {{0x54445355544f44ULL, 0x0ULL}, 401}, // DOTUSDT
+    {{0x434453554644ULL, 0x0ULL}, 373}, // DFUSDC
+    {{0x59525444ULL, 0x0ULL}, 402}, // DTRY
+    {{0x435442564c49ULL, 0x0ULL}, 620}, // ILVBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535554505258ULL, 0x0ULL}, 1392}, // XRPTUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254525341ULL, 0x0ULL}, 137}, // ASRTRY
+    {{0x434453554d4f5441ULL, 0x0ULL}, 150}, // ATOMUSDC
+    {{0x5255454b4e494cULL, 0x0ULL}, 716}, // LINKEUR
+    {{0x435442485445ULL, 0x0ULL}, 461}, // ETHBTC
+    {{0x5952544f42525554ULL, 0x0ULL}, 1264}, // TURBOTRY
+    {{0x54445355454d4f42ULL, 0x0ULL}, 266}, // BOMEUSDT
+    {{0x5444535541505241ULL, 0x0ULL}, 133}, // ARPAUSDT
+    {{0x43544252414248ULL, 0x0ULL}, 574}, // HBARBTC
+    {{0x43544252574f50ULL, 0x0ULL}, 972}, // POWRBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445535841ULL, 0x0ULL}, 178}, // AXSETH
+    {{0x54445355525341ULL, 0x0ULL}, 138}, // ASRUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e424c494eULL, 0x0ULL}, 833}, // NILBNB
+    {{0x435442454dULL, 0x0ULL}, 778}, // MEBTC
+    {{0x4344535552534e54ULL, 0x0ULL}, 1232}, // TNSRUSDC
+    {{0x4453554f42525554ULL, 0x54ULL}, 1266}, // TURBOUSDT
+    {{0x595254434947414dULL, 0x0ULL}, 758}, // MAGICTRY
+    {{0x544453554f4e47ULL, 0x0ULL}, 547}, // GNOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535554ULL, 0x0ULL}, 1268}, // TUSDT
+    {{0x59504a505258ULL, 0x0ULL}, 1389}, // XRPJPY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254544f44ULL, 0x0ULL}, 399}, // DOTTRY
+    {{0x445355444657ULL, 0x0ULL}, 1347}, // WFDUSD
+    {{0x4f44594241424d31ULL, 0x44535544464547ULL}, 13}, // 1MBABYDOGEFDUSD
+    {{0x544453554f444cULL, 0x0ULL}, 709}, // LDOUSDT
+    {{0x54445355494553ULL, 0x0ULL}, 1082}, // SEIUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442494553ULL, 0x0ULL}, 1077}, // SEIBTC
+    {{0x54445355524d4eULL, 0x0ULL}, 841}, // NMRUSDT
+    {{0x4354424f49445541ULL, 0x0ULL}, 157}, // AUDIOBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355484341ULL, 0x0ULL}, 30}, // ACHUSDT
+    {{0x4354424b534cULL, 0x0ULL}, 737}, // LSKBTC
+    {{0x5355444654494e49ULL, 0x44ULL}, 625}, // INITFDUSD
+    {{0x52554553ULL, 0x0ULL}, 1084}, // SEUR
+    {{0x48544558544f49ULL, 0x0ULL}, 647}, // IOTXETH
+    {{0x59525445524152ULL, 0x0ULL}, 1000}, // RARETRY
+    {{0x424e424a4e49ULL, 0x0ULL}, 629}, // INJBNB
+    {{0x4354424944524fULL, 0x0ULL}, 892}, // ORDIBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355504349ULL, 0x0ULL}, 611}, // ICPUSDT
+    {{0x5444535553474f44ULL, 0x0ULL}, 392}, // DOGSUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355435442ULL, 0x0ULL}, 290}, // BTCUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535544464b5aULL, 0x0ULL}, 1423}, // ZKFDUSD
+    {{0x4344535541474153ULL, 0x0ULL}, 1056}, // SAGAUSDC
+    {{0x4354424d45455453ULL, 0x0ULL}, 1142}, // STEEMBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355424e42ULL, 0x0ULL}, 258}, // BNBUSDT
+    {{0x4453554446455041ULL, 0x0ULL}, 95}, // APEFDUSD
+    {{0x43445355444c57ULL, 0x0ULL}, 1362}, // WLDUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554f444cULL, 0x0ULL}, 708}, // LDOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445545041ULL, 0x0ULL}, 104}, // APTETH
+    {{0x5952545841525453ULL, 0x0ULL}, 1157}, // STRAXTRY
+    {{0x424e42544f44ULL, 0x0ULL}, 393}, // DOTBNB
+    {{0x5952544c495aULL, 0x0ULL}, 1420}, // ZILTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545544d47ULL, 0x0ULL}, 541}, // GMTEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355454dULL, 0x0ULL}, 787}, // MEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525452414248ULL, 0x0ULL}, 576}, // HBARTRY
+    {{0x4e424c454e52454bULL, 0x42ULL}, 683}, // KERNELBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254434558ULL, 0x0ULL}, 1371}, // XECTRY
+    {{0x44464c4154524f50ULL, 0x445355ULL}, 967}, // PORTALFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453555355544543ULL, 0x54ULL}, 310}, // CETUSUSDT
+    {{0x54445355414e4156ULL, 0x0ULL}, 1311}, // VANAUSDT
+    {{0x53554c4144454148ULL, 0x4344ULL}, 571}, // HAEDALUSDC
+    {{0x4545484330303031ULL, 0x54445355534dULL}, 6}, // 1000CHEEMSUSDT
+    {{0x59525454504cULL, 0x0ULL}, 730}, // LPTTRY
+    {{0x435442544c41ULL, 0x0ULL}, 80}, // ALTBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x445355444653ULL, 0x0ULL}, 1085}, // SFDUSD
+    {{0x554e4f4954435541ULL, 0x544453ULL}, 156}, // AUCTIONUSDT
+    {{0x5952544f5453ULL, 0x0ULL}, 1153}, // STOTRY
+    {{0x4354424e455aULL, 0x0ULL}, 1415}, // ZENBTC
+    {{0x4453554446534f45ULL, 0x0ULL}, 447}, // EOSFDUSD
+    {{0x4c524254554e50ULL, 0x0ULL}, 944}, // PNUTBRL
+    {{0x54425245444e4552ULL, 0x43ULL}, 1016}, // RENDERBTC
+    {{0x43544243455aULL, 0x0ULL}, 1412}, // ZECBTC
+    {{0x45474f4442494853ULL, 0x0ULL}, 1095}, // SHIBDOGE
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453555841525453ULL, 0x54ULL}, 1158}, // STRAXUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544f564541ULL, 0x0ULL}, 57}, // AEVOTRY
+    {{0x43445355494548ULL, 0x0ULL}, 580}, // HEIUSDC
+    {{0x43445355414441ULL, 0x0ULL}, 49}, // ADAUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446534e45ULL, 0x0ULL}, 441}, // ENSFDUSD
+    {{0x43544254504cULL, 0x0ULL}, 729}, // LPTBTC
+    {{0x54445355545247ULL, 0x0ULL}, 559}, // GRTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355454341ULL, 0x0ULL}, 26}, // ACEUSDT
+    {{0x435442524843ULL, 0x0ULL}, 319}, // CHRBTC
+    {{0x595254535658ULL, 0x0ULL}, 1404}, // XVSTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445414e414dULL, 0x0ULL}, 761}, // MANAETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355485445ULL, 0x0ULL}, 476}, // ETHUSDT
+    {{0x43445355584341ULL, 0x0ULL}, 39}, // ACXUSDC
+    {{0x4354424c4946ULL, 0x0ULL}, 496}, // FILBTC
+    {{0x4354424d534bULL, 0x0ULL}, 694}, // KSMBTC
+    {{0x5952544b5241ULL, 0x0ULL}, 129}, // ARKTRY
+    {{0x4354424f4946ULL, 0x0ULL}, 502}, // FIOBTC
+    {{0x59525441544f49ULL, 0x0ULL}, 642}, // IOTATRY
+    {{0x4453554446545354ULL, 0x0ULL}, 1260}, // TSTFDUSD
+    {{0x43544252445241ULL, 0x0ULL}, 120}, // ARDRBTC
+    {{0x43544245564948ULL, 0x0ULL}, 587}, // HIVEBTC
+    {{0x43445355454e5552ULL, 0x0ULL}, 1047}, // RUNEUSDC
+    {{0x595254545247ULL, 0x0ULL}, 558}, // GRTTRY
+    {{0x424e424e474953ULL, 0x0ULL}, 1102}, // SIGNBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544f525aULL, 0x0ULL}, 1429}, // ZROTRY
+    {{0x435442544d47ULL, 0x0ULL}, 540}, // GMTBTC
+    {{0x434453554f454eULL, 0x0ULL}, 825}, // NEOUSDC
+    {{0x595254444c57ULL, 0x0ULL}, 1361}, // WLDTRY
+    {{0x54445355424b43ULL, 0x0ULL}, 330}, // CKBUSDT
+    {{0x544453554d5944ULL, 0x0ULL}, 412}, // DYMUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355494e4d4fULL, 0x0ULL}, 865}, // OMNIUSDT
+    {{0x4453554446545041ULL, 0x0ULL}, 106}, // APTFDUSD
+    {{0x53554446494e4d4fULL, 0x44ULL}, 862}, // OMNIFDUSD
+    {{0x424e424f4942ULL, 0x0ULL}, 235}, // BIOBNB
+    {{0x43445355544546ULL, 0x0ULL}, 491}, // FETUSDC
+    {{0x52554558415641ULL, 0x0ULL}, 166}, // AVAXEUR
+    {{0x5444535545474f44ULL, 0x0ULL}, 388}, // DOGEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x554c415554524956ULL, 0x544453ULL}, 1328}, // VIRTUALUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554d524146ULL, 0x0ULL}, 483}, // FARMUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442544556ULL, 0x0ULL}, 1318}, // VETBTC
+    {{0x4453554446545853ULL, 0x0ULL}, 1193}, // SXTFDUSD
+    {{0x595254594152ULL, 0x0ULL}, 1004}, // RAYTRY
+    {{0x43445355424b43ULL, 0x0ULL}, 329}, // CKBUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446544f4eULL, 0x0ULL}, 842}, // NOTFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355534e47ULL, 0x0ULL}, 548}, // GNSUSDT
+    {{0x434453555a5458ULL, 0x0ULL}, 1396}, // XTZUSDC
+    {{0x5444535559544943ULL, 0x0ULL}, 327}, // CITYUSDT
+    {{0x54445355544f48ULL, 0x0ULL}, 599}, // HOTUSDT
+    {{0x595254504d4f43ULL, 0x0ULL}, 332}, // COMPTRY
+    {{0x445355415453494cULL, 0x54ULL}, 725}, // LISTAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254544d42ULL, 0x0ULL}, 245}, // BMTTRY
+    {{0x424e42585254ULL, 0x0ULL}, 1251}, // TRXBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535545564948ULL, 0x0ULL}, 591}, // HIVEUSDT
+    {{0x435442494659ULL, 0x0ULL}, 1406}, // YFIBTC
+    {{0x5444535541474153ULL, 0x0ULL}, 1057}, // SAGAUSDT
+    {{0x595254534f43ULL, 0x0ULL}, 336}, // COSTRY
+    {{0x4453554446594152ULL, 0x0ULL}, 1003}, // RAYFDUSD
+    {{0x53554c4144454148ULL, 0x5444ULL}, 572}, // HAEDALUSDT
+    {{0x52545245444e4552ULL, 0x59ULL}, 1019}, // RENDERTRY
+    {{0x4453554446544d42ULL, 0x0ULL}, 244}, // BMTFDUSD
+    {{0x43445355454d454dULL, 0x0ULL}, 782}, // MEMEUSDC
+    {{0x595254504fULL, 0x0ULL}, 885}, // OPTRY
+    {{0x434453554f4d534fULL, 0x0ULL}, 897}, // OSMOUSDC
+    {{0x4453555442584941ULL, 0x43ULL}, 67}, // AIXBTUSDC
+    {{0x54445355494e55ULL, 0x0ULL}, 1282}, // UNIUSDT
+    {{0x595254525352ULL, 0x0ULL}, 1041}, // RSRTRY
+    {{0x59525445564948ULL, 0x0ULL}, 589}, // HIVETRY
+    {{0x5354415330303031ULL, 0x54445355ULL}, 10}, // 1000SATSUSDT
+    {{0x435442584643ULL, 0x0ULL}, 311}, // CFXBTC
+    {{0x435442474fULL, 0x0ULL}, 854}, // OGBTC
+    {{0x5444535545524152ULL, 0x0ULL}, 1002}, // RAREUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544f4c4543ULL, 0x0ULL}, 305}, // CELOTRY
+    {{0x4354425245425943ULL, 0x0ULL}, 357}, // CYBERBTC
+    {{0x435442545247ULL, 0x0ULL}, 554}, // GRTBTC
+    {{0x4354424b5443ULL, 0x0ULL}, 349}, // CTKBTC
+    {{0x595254544e4452ULL, 0x0ULL}, 1007}, // RDNTTRY
+    {{0x5952544f5449414bULL, 0x0ULL}, 676}, // KAITOTRY
+    {{0x5442414e414e4142ULL, 0x43ULL}, 191}, // BANANABTC
+    {{0x59525455474e4550ULL, 0x0ULL}, 916}, // PENGUTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355485445ULL, 0x0ULL}, 475}, // ETHUSDC
+    {{0x54445355545041ULL, 0x0ULL}, 110}, // APTUSDT
+    {{0x544453554d4c58ULL, 0x0ULL}, 1380}, // XLMUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e424c4f50ULL, 0x0ULL}, 951}, // POLBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x52554545474f44ULL, 0x0ULL}, 382}, // DOGEEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x48544543455aULL, 0x0ULL}, 1413}, // ZECETH
+    {{0x535544464350584eULL, 0x44ULL}, 850}, // NXPCFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535547584150ULL, 0x0ULL}, 909}, // PAXGUSDT
+    {{0x54445355494552ULL, 0x0ULL}, 1014}, // REIUSDT
+    {{0x4453554c45554654ULL, 0x54ULL}, 1210}, // TFUELUSDT
+    {{0x5444535545564f4dULL, 0x0ULL}, 801}, // MOVEUSDT
+    {{0x595254564c4f53ULL, 0x0ULL}, 1135}, // SOLVTRY
+    {{0x43445355545554ULL, 0x0ULL}, 1270}, // TUTUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544245474f44ULL, 0x0ULL}, 381}, // DOGEBTC
+    {{0x434453554e455aULL, 0x0ULL}, 1416}, // ZENUSDC
+    {{0x424e42484342ULL, 0x0ULL}, 210}, // BCHBNB
+    {{0x595254505853ULL, 0x0ULL}, 1190}, // SXPTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554d45455453ULL, 0x43ULL}, 1144}, // STEEMUSDC
+    {{0x544453554f49ULL, 0x0ULL}, 651}, // IOUSDT
+    {{0x5952544b525453ULL, 0x0ULL}, 1160}, // STRKTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525450464eULL, 0x0ULL}, 831}, // NFPTRY
+    {{0x4354424b535544ULL, 0x0ULL}, 404}, // DUSKBTC
+    {{0x43544243544257ULL, 0x0ULL}, 1339}, // WBTCBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535552564f4dULL, 0x0ULL}, 804}, // MOVRUSDT
+    {{0x485445504349ULL, 0x0ULL}, 606}, // ICPETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424941ULL, 0x0ULL}, 62}, // AIBTC
+    {{0x525545414441ULL, 0x0ULL}, 45}, // ADAEUR
+    {{0x4854455241454eULL, 0x0ULL}, 812}, // NEARETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4854454d4c58ULL, 0x0ULL}, 1374}, // XLMETH
+    {{0x435442495553ULL, 0x0ULL}, 1172}, // SUIBTC
+    {{0x52425245444e4552ULL, 0x4cULL}, 1015}, // RENDERBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355544357ULL, 0x0ULL}, 1346}, // WCTUSDT
+    {{0x4e584d4c4f53ULL, 0x0ULL}, 1128}, // SOLMXN
+    {{0x54445355534946ULL, 0x0ULL}, 505}, // FISUSDT
+    {{0x54445355434956ULL, 0x0ULL}, 1325}, // VICUSDT
+    {{0x5444535545564141ULL, 0x0ULL}, 22}, // AAVEUSDT
+    {{0x5444535552414248ULL, 0x0ULL}, 578}, // HBARUSDT
+    {{0x4c5242414e45ULL, 0x0ULL}, 430}, // ENABRL
+    {{0x4354424f454eULL, 0x0ULL}, 823}, // NEOBTC
+    {{0x4453555245505948ULL, 0x43ULL}, 603}, // HYPERUSDC
+    {{0x4c5242485445ULL, 0x0ULL}, 460}, // ETHBRL
+    {{0x43445355544357ULL, 0x0ULL}, 1345}, // WCTUSDC
+    {{0x5444535549464942ULL, 0x0ULL}, 232}, // BIFIUSDT
+    {{0x595254454854ULL, 0x0ULL}, 1217}, // THETRY
+    {{0x5952544242ULL, 0x0ULL}, 207}, // BBTRY
+    {{0x43445355545041ULL, 0x0ULL}, 109}, // APTUSDC
+    {{0x5444535543524cULL, 0x0ULL}, 736}, // LRCUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554f495a414cULL, 0x54ULL}, 704}, // LAZIOUSDT
+    {{0x5444535550524550ULL, 0x0ULL}, 931}, // PERPUSDT
+    {{0x54445355544c41ULL, 0x0ULL}, 84}, // ALTUSDT
+    {{0x4854454d4f5441ULL, 0x0ULL}, 146}, // ATOMETH
+    {{0x5952544543494c41ULL, 0x0ULL}, 74}, // ALICETRY
+    {{0x544453554f4e4d4bULL, 0x0ULL}, 691}, // KMNOUSDT
+    {{0x5554414330303031ULL, 0x434453ULL}, 3}, // 1000CATUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554350584eULL, 0x0ULL}, 853}, // NXPCUSDT
+    {{0x53554446454e5552ULL, 0x44ULL}, 1046}, // RUNEFDUSD
+    {{0x435442454e5552ULL, 0x0ULL}, 1044}, // RUNEBTC
+    {{0x424e42524559414cULL, 0x0ULL}, 697}, // LAYERBNB
+    {{0x54445355534f43ULL, 0x0ULL}, 337}, // COSUSDT
+    {{0x595254494553ULL, 0x0ULL}, 1080}, // SEITRY
+    {{0x544453554d4f5441ULL, 0x0ULL}, 151}, // ATOMUSDT
+    {{0x4c524258415641ULL, 0x0ULL}, 163}, // AVAXBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355584d47ULL, 0x0ULL}, 546}, // GMXUSDT
+    {{0x535544464944524fULL, 0x44ULL}, 893}, // ORDIFDUSD
+    {{0x54445355455041ULL, 0x0ULL}, 98}, // APEUSDT
+    {{0x5444535554534aULL, 0x0ULL}, 658}, // JSTUSDT
+    {{0x435442414954ULL, 0x0ULL}, 1220}, // TIABTC
+    {{0x3353414e414e4142ULL, 0x5444535531ULL}, 194}, // BANANAS31USDT
+    {{0x5444535541444bULL, 0x0ULL}, 682}, // KDAUSDT
+    {{0x43445355535047ULL, 0x0ULL}, 552}, // GPSUSDC
+    {{0x5444535558415641ULL, 0x0ULL}, 170}, // AVAXUSDT
+    {{0x54445355454f4aULL, 0x0ULL}, 656}, // JOEUSDT
+    {{0x4453555445474f44ULL, 0x0ULL}, 386}, // DOGETUSD
+    {{0x59525453ULL, 0x0ULL}, 1163}, // STRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535545504550ULL, 0x0ULL}, 929}, // PEPEUSDC
+    {{0x59504a4c4f53ULL, 0x0ULL}, 1127}, // SOLJPY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544948535553ULL, 0x0ULL}, 1187}, // SUSHITRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355475453ULL, 0x0ULL}, 1147}, // STGUSDT
+    {{0x59525445564f4dULL, 0x0ULL}, 799}, // MOVETRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445545247ULL, 0x0ULL}, 555}, // GRTETH
+    {{0x54445355504653ULL, 0x0ULL}, 1087}, // SFPUSDT
+    {{0x4854454c495aULL, 0x0ULL}, 1419}, // ZILETH
+    {{0x54445355414b4f4cULL, 0x0ULL}, 727}, // LOKAUSDT
+    {{0x4c52424c4f53ULL, 0x0ULL}, 1122}, // SOLBRL
+    {{0x4e4f52435442ULL, 0x0ULL}, 285}, // BTCRON
+    {{0x595254435442ULL, 0x0ULL}, 286}, // BTCTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f444f44ULL, 0x0ULL}, 379}, // DODOUSDT
+    {{0x4453554c4f534e42ULL, 0x54ULL}, 260}, // BNSOLUSDT
+    {{0x5952544d5944ULL, 0x0ULL}, 411}, // DYMTRY
+    {{0x48544543544257ULL, 0x0ULL}, 1340}, // WBTCETH
+    {{0x4354424e474fULL, 0x0ULL}, 855}, // OGNBTC
+    {{0x44535544464c494eULL, 0x0ULL}, 834}, // NILFDUSD
+    {{0x595254454e4fULL, 0x0ULL}, 873}, // ONETRY
+    {{0x48415554445355ULL, 0x0ULL}, 1297}, // USDTUAH
+    {{0x59525454445355ULL, 0x0ULL}, 1296}, // USDTTRY
+    {{0x554e4f4954435541ULL, 0x434453ULL}, 155}, // AUCTIONUSDC
+    {{0x424e424f49ULL, 0x0ULL}, 636}, // IOBNB
+    {{0x595254584e53ULL, 0x0ULL}, 1118}, // SNXTRY
+    {{0x54445355545554ULL, 0x0ULL}, 1271}, // TUTUSDT
+    {{0x54445355414e414dULL, 0x0ULL}, 763}, // MANAUSDT
+    {{0x5952544f474c41ULL, 0x0ULL}, 71}, // ALGOTRY
+    {{0x55444641544e414dULL, 0x4453ULL}, 765}, // MANTAFDUSD
+    {{0x4c5242505258ULL, 0x0ULL}, 1384}, // XRPBRL
+    {{0x5444535543455aULL, 0x0ULL}, 1414}, // ZECUSDT
+    {{0x54445355454b4142ULL, 0x0ULL}, 189}, // BAKEUSDT
+    {{0x595254414e45ULL, 0x0ULL}, 433}, // ENATRY
+    {{0x4453554453554446ULL, 0x43ULL}, 485}, // FDUSDUSDC
+    {{0x4453554446544357ULL, 0x0ULL}, 1343}, // WCTFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355544d42ULL, 0x0ULL}, 247}, // BMTUSDT
+    {{0x4344535558445944ULL, 0x0ULL}, 409}, // DYDXUSDC
+    {{0x4354424c495aULL, 0x0ULL}, 1418}, // ZILBTC
+    {{0x4446454c444e4550ULL, 0x445355ULL}, 911}, // PENDLEFDUSD
+    {{0x4344535554494e49ULL, 0x0ULL}, 627}, // INITUSDC
+    {{0x44535541494d554cULL, 0x54ULL}, 752}, // LUMIAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535553ULL, 0x0ULL}, 1185}, // SUSDT
+    {{0x595254555254ULL, 0x0ULL}, 1249}, // TRUTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525443545355ULL, 0x0ULL}, 1299}, // USTCTRY
+    {{0x5442454c504f4550ULL, 0x43ULL}, 919}, // PEOPLEBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446545247ULL, 0x0ULL}, 557}, // GRTFDUSD
+    {{0x485445424e42ULL, 0x0ULL}, 251}, // BNBETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525445564141ULL, 0x0ULL}, 20}, // AAVETRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535533495041ULL, 0x0ULL}, 101}, // API3USDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x53554446444c4745ULL, 0x44ULL}, 419}, // EGLDFDUSD
+    {{0x4453554446504fULL, 0x0ULL}, 884}, // OPFDUSD
+    {{0x595254444c4745ULL, 0x0ULL}, 421}, // EGLDTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5254454c444e4550ULL, 0x59ULL}, 912}, // PENDLETRY
+    {{0x43445355534f45ULL, 0x0ULL}, 449}, // EOSUSDC
+    {{0x4e584d435442ULL, 0x0ULL}, 283}, // BTCMXN
+    {{0x544453554f544cULL, 0x0ULL}, 750}, // LTOUSDT
+    {{0x54445355434e554cULL, 0x0ULL}, 756}, // LUNCUSDT
+    {{0x54445355545446ULL, 0x0ULL}, 521}, // FTTUSDT
+    {{0x43445355494e55ULL, 0x0ULL}, 1281}, // UNIUSDC
+    {{0x44535555474e4550ULL, 0x54ULL}, 918}, // PENGUUSDT
+    {{0x5255454d4f5441ULL, 0x0ULL}, 147}, // ATOMEUR
+    {{0x4854454b4e494cULL, 0x0ULL}, 715}, // LINKETH
+    {{0x4344535559424142ULL, 0x0ULL}, 185}, // BABYUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453555353454843ULL, 0x43ULL}, 317}, // CHESSUSDC
+    {{0x5952545254534d48ULL, 0x0ULL}, 593}, // HMSTRTRY
+    {{0x544453554f4b54ULL, 0x0ULL}, 1225}, // TKOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442454b4143ULL, 0x0ULL}, 296}, // CAKEBTC
+    {{0x554b41524142554dULL, 0x544453ULL}, 808}, // MUBARAKUSDT
+    {{0x485445425241ULL, 0x0ULL}, 112}, // ARBETH
+    {{0x5444535554494e49ULL, 0x0ULL}, 628}, // INITUSDT
+    {{0x5952544d4b5241ULL, 0x0ULL}, 126}, // ARKMTRY
+    {{0x535544465241454eULL, 0x44ULL}, 814}, // NEARFDUSD
+    {{0x435442504d4f43ULL, 0x0ULL}, 331}, // COMPBTC
+    {{0x49525545525545ULL, 0x0ULL}, 478}, // EUREURI
+    {{0x4453554446454854ULL, 0x0ULL}, 1211}, // THEFDUSD
+    {{0x435442464957ULL, 0x0ULL}, 1349}, // WIFBTC
+    {{0x4354424d4f5441ULL, 0x0ULL}, 145}, // ATOMBTC
+    {{0x5444535552554541ULL, 0x0ULL}, 54}, // AEURUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x535544464b525453ULL, 0x44ULL}, 1159}, // STRKFDUSD
+    {{0x434453554b4e494cULL, 0x0ULL}, 720}, // LINKUSDC
+    {{0x5952544d4f5441ULL, 0x0ULL}, 149}, // ATOMTRY
+    {{0x54445355414e554cULL, 0x0ULL}, 754}, // LUNAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f485456ULL, 0x0ULL}, 1331}, // VTHOUSDT
+    {{0x5952544c4c454853ULL, 0x0ULL}, 1091}, // SHELLTRY
+    {{0x544453554b5455ULL, 0x0ULL}, 1307}, // UTKUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4c52424b4e4f42ULL, 0x0ULL}, 267}, // BONKBRL
+    {{0x424e425245505948ULL, 0x0ULL}, 600}, // HYPERBNB
+    {{0x43544233495041ULL, 0x0ULL}, 99}, // API3BTC
+    {{0x544453554f444e4fULL, 0x0ULL}, 871}, // ONDOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355444152ULL, 0x0ULL}, 998}, // RADUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4545484330303031ULL, 0x43445355534dULL}, 5}, // 1000CHEEMSUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442434947414dULL, 0x0ULL}, 757}, // MAGICBTC
+    {{0x5952544d555451ULL, 0x0ULL}, 994}, // QTUMTRY
+    {{0x4c524243544cULL, 0x0ULL}, 740}, // LTCBRL
+    {{0x424e42585453ULL, 0x0ULL}, 1164}, // STXBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5355444653474f44ULL, 0x44ULL}, 389}, // DOGSFDUSD
+    {{0x4344535548545950ULL, 0x0ULL}, 985}, // PYTHUSDC
+    {{0x424e424e52544eULL, 0x0ULL}, 846}, // NTRNBNB
+    {{0x445355494b4f4c46ULL, 0x43ULL}, 510}, // FLOKIUSDC
+    {{0x43445355414c4147ULL, 0x0ULL}, 530}, // GALAUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4854454c4946ULL, 0x0ULL}, 497}, // FILETH
+    {{0x54445355524b4e41ULL, 0x0ULL}, 93}, // ANKRUSDT
+    {{0x595254444552ULL, 0x0ULL}, 1011}, // REDTRY
+    {{0x44535554435442ULL, 0x0ULL}, 287}, // BTCTUSD
+    {{0x4453554d45455453ULL, 0x54ULL}, 1145}, // STEEMUSDT
+    {{0x595254505258ULL, 0x0ULL}, 1391}, // XRPTRY
+    {{0x525545545041ULL, 0x0ULL}, 105}, // APTEUR
+    {{0x44535559524e4156ULL, 0x54ULL}, 1314}, // VANRYUSDT
+    {{0x43445355504349ULL, 0x0ULL}, 610}, // ICPUSDC
+    {{0x44464c454e52454bULL, 0x445355ULL}, 684}, // KERNELFDUSD
+    {{0x435442525950ULL, 0x0ULL}, 980}, // PYRBTC
+    {{0x4354424f4c4543ULL, 0x0ULL}, 304}, // CELOBTC
+    {{0x54445355584e53ULL, 0x0ULL}, 1119}, // SNXUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4e584d54445355ULL, 0x0ULL}, 1294}, // USDTMXN
+    {{0x54445355435643ULL, 0x0ULL}, 354}, // CVCUSDT
+    {{0x595254454d454dULL, 0x0ULL}, 781}, // MEMETRY
+    {{0x424e4243544cULL, 0x0ULL}, 739}, // LTCBNB
+    {{0x435442535658ULL, 0x0ULL}, 1403}, // XVSBTC
+    {{0x54445355544546ULL, 0x0ULL}, 492}, // FETUSDT
+    {{0x4453554446504349ULL, 0x0ULL}, 608}, // ICPFDUSD
+    {{0x53554446454d454dULL, 0x44ULL}, 780}, // MEMEFDUSD
+    {{0x4354424c4f50ULL, 0x0ULL}, 953}, // POLBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554854524f46ULL, 0x54ULL}, 520}, // FORTHUSDT
+    {{0x54445355414944ULL, 0x0ULL}, 377}, // DIAUSDT
+    {{0x59525441505241ULL, 0x0ULL}, 132}, // ARPATRY
+    {{0x43544241505241ULL, 0x0ULL}, 131}, // ARPABTC
+    {{0x5444535542494853ULL, 0x0ULL}, 1101}, // SHIBUSDT
+    {{0x43544258544f49ULL, 0x0ULL}, 646}, // IOTXBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4e4f52444c4745ULL, 0x0ULL}, 420}, // EGLDRON
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355544556ULL, 0x0ULL}, 1322}, // VETUSDC
+    {{0x5444535541544f49ULL, 0x0ULL}, 644}, // IOTAUSDT
+    {{0x5355444658445944ULL, 0x44ULL}, 407}, // DYDXFDUSD
+    {{0x4453554446524353ULL, 0x0ULL}, 1070}, // SCRFDUSD
+    {{0x5352414c4f53ULL, 0x0ULL}, 1120}, // SOLARS
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355545354ULL, 0x0ULL}, 1262}, // TSTUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554b534cULL, 0x0ULL}, 738}, // LSKUSDT
+    {{0x5952544a4e45ULL, 0x0ULL}, 437}, // ENJTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4c524242494853ULL, 0x0ULL}, 1094}, // SHIBBRL
+    {{0x54445355414e494dULL, 0x0ULL}, 790}, // MINAUSDT
+    {{0x54445355524344ULL, 0x0ULL}, 367}, // DCRUSDT
+    {{0x4e4f5243445355ULL, 0x0ULL}, 1286}, // USDCRON
+    {{0x54445355464957ULL, 0x0ULL}, 1354}, // WIFUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254494e4d4fULL, 0x0ULL}, 863}, // OMNITRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544f49ULL, 0x0ULL}, 645}, // IOTRY
+    {{0x544453554e5546ULL, 0x0ULL}, 522}, // FUNUSDT
+    {{0x595254544556ULL, 0x0ULL}, 1321}, // VETTRY
+    {{0x5952544e494e4f52ULL, 0x0ULL}, 1034}, // RONINTRY
+    {{0x435442565353ULL, 0x0ULL}, 1139}, // SSVBTC
+    {{0x43445355544e51ULL, 0x0ULL}, 990}, // QNTUSDC
+    {{0x43445355504fULL, 0x0ULL}, 886}, // OPUSDC
+    {{0x54445355584f424dULL, 0x0ULL}, 776}, // MBOXUSDT
+    {{0x5355444649544143ULL, 0x44ULL}, 300}, // CATIFDUSD
+    {{0x544453554d4341ULL, 0x0ULL}, 31}, // ACMUSDT
+    {{0x48544543524cULL, 0x0ULL}, 734}, // LRCETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535541544e414dULL, 0x43ULL}, 767}, // MANTAUSDC
+    {{0x5952544c45584950ULL, 0x0ULL}, 941}, // PIXELTRY
+    {{0x434453554a4e49ULL, 0x0ULL}, 634}, // INJUSDC
+    {{0x43445355574f43ULL, 0x0ULL}, 342}, // COWUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x464e4f4954435541ULL, 0x44535544ULL}, 153}, // AUCTIONFDUSD
+    {{0x5444535554534847ULL, 0x0ULL}, 535}, // GHSTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254454b4142ULL, 0x0ULL}, 188}, // BAKETRY
+    {{0x494144435442ULL, 0x0ULL}, 278}, // BTCDAI
+    {{0x52415a485445ULL, 0x0ULL}, 477}, // ETHZAR
+    {{0x59525441474153ULL, 0x0ULL}, 1055}, // SAGATRY
+    {{0x4453554e45474945ULL, 0x43ULL}, 427}, // EIGENUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544254554e50ULL, 0x0ULL}, 945}, // PNUTBTC
+    {{0x44535544464e5547ULL, 0x0ULL}, 563}, // GUNFDUSD
+    {{0x484155435442ULL, 0x0ULL}, 288}, // BTCUAH
+    {{0x435442414b4f4cULL, 0x0ULL}, 726}, // LOKABTC
+    {{0x52544c4154524f50ULL, 0x59ULL}, 968}, // PORTALTRY
+    {{0x435442534e45ULL, 0x0ULL}, 440}, // ENSBTC
+    {{0x4c524245504550ULL, 0x0ULL}, 924}, // PEPEBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442444c4745ULL, 0x0ULL}, 416}, // EGLDBTC
+    {{0x5444535552574f50ULL, 0x0ULL}, 974}, // POWRUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355525545ULL, 0x0ULL}, 481}, // EURUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525443545442ULL, 0x0ULL}, 292}, // BTTCTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5354415330303031ULL, 0x43445355ULL}, 9}, // 1000SATSUSDC
+    {{0x4e4c5043445355ULL, 0x0ULL}, 1285}, // USDCPLN
+    {{0x434453554149414bULL, 0x0ULL}, 670}, // KAIAUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535548474948ULL, 0x0ULL}, 586}, // HIGHUSDT
+    {{0x5444535549544143ULL, 0x0ULL}, 303}, // CATIUSDT
+    {{0x54445355414954ULL, 0x0ULL}, 1224}, // TIAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554d4c54ULL, 0x0ULL}, 1228}, // TLMUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535543545355ULL, 0x0ULL}, 1300}, // USTCUSDT
+    {{0x5454414330303031ULL, 0x5952ULL}, 2}, // 1000CATTRY
+    {{0x535241435442ULL, 0x0ULL}, 276}, // BTCARS
+    {{0x54445355534f45ULL, 0x0ULL}, 450}, // EOSUSDT
+    {{0x4854454854454257ULL, 0x0ULL}, 1336}, // WBETHETH
+    {{0x595254414e554cULL, 0x0ULL}, 753}, // LUNATRY
+    {{0x434453554b5aULL, 0x0ULL}, 1425}, // ZKUSDC
+    {{0x435442425241ULL, 0x0ULL}, 111}, // ARBBTC
+    {{0x424e42535658ULL, 0x0ULL}, 1402}, // XVSBNB
+    {{0x595254435445ULL, 0x0ULL}, 457}, // ETCTRY
+    {{0x445355534954454dULL, 0x54ULL}, 785}, // METISUSDT
+    {{0x5355444645474f44ULL, 0x44ULL}, 383}, // DOGEFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535549464948ULL, 0x0ULL}, 584}, // HIFIUSDT
+    {{0x554446454d494e41ULL, 0x4453ULL}, 87}, // ANIMEFDUSD
+    {{0x544453554143524fULL, 0x0ULL}, 891}, // ORCAUSDT
+    {{0x595254544546ULL, 0x0ULL}, 490}, // FETTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544258554c46ULL, 0x0ULL}, 514}, // FLUXBTC
+    {{0x544453554e52544eULL, 0x0ULL}, 848}, // NTRNUSDT
+    {{0x5952544f444cULL, 0x0ULL}, 707}, // LDOTRY
+    {{0x43445355565243ULL, 0x0ULL}, 346}, // CRVUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x535241424e42ULL, 0x0ULL}, 248}, // BNBARS
+    {{0x595254444e4153ULL, 0x0ULL}, 1060}, // SANDTRY
+    {{0x4453554c45584950ULL, 0x54ULL}, 943}, // PIXELUSDT
+    {{0x435442414944ULL, 0x0ULL}, 376}, // DIABTC
+    {{0x595254494158ULL, 0x0ULL}, 1369}, // XAITRY
+    {{0x435442524559414cULL, 0x0ULL}, 698}, // LAYERBTC
+    {{0x595254415453494cULL, 0x0ULL}, 724}, // LISTATRY
+    {{0x4354424e4b4eULL, 0x0ULL}, 838}, // NKNBTC
+    {{0x544453554f4154ULL, 0x0ULL}, 1208}, // TAOUSDT
+    {{0x535545494b4f4f43ULL, 0x4344ULL}, 334}, // COOKIEUSDC
+    {{0x595254475350ULL, 0x0ULL}, 976}, // PSGTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535543495045ULL, 0x0ULL}, 451}, // EPICUSDC
+    {{0x435442494e55ULL, 0x0ULL}, 1277}, // UNIBTC
+    {{0x52554543544cULL, 0x0ULL}, 743}, // LTCEUR
+    {{0x424e42454b4143ULL, 0x0ULL}, 295}, // CAKEBNB
+    {{0x5355444645564f4dULL, 0x44ULL}, 798}, // MOVEFDUSD
+    {{0x44535548434e4931ULL, 0x54ULL}, 12}, // 1INCHUSDT
+    {{0x4654414330303031ULL, 0x44535544ULL}, 1}, // 1000CATFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535552534e54ULL, 0x0ULL}, 1233}, // TNSRUSDT
+    {{0x5952544c41555355ULL, 0x0ULL}, 1303}, // USUALTRY
+    {{0x5952544f4154ULL, 0x0ULL}, 1206}, // TAOTRY
+    {{0x434453554143524fULL, 0x0ULL}, 890}, // ORCAUSDC
+    {{0x595254454b4143ULL, 0x0ULL}, 297}, // CAKETRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f4942ULL, 0x0ULL}, 239}, // BIOUSDT
+    {{0x595254464957ULL, 0x0ULL}, 1352}, // WIFTRY
+    {{0x435442484342ULL, 0x0ULL}, 211}, // BCHBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442434c52ULL, 0x0ULL}, 1029}, // RLCBTC
+    {{0x54445355534147ULL, 0x0ULL}, 534}, // GASUSDT
+    {{0x435442585453ULL, 0x0ULL}, 1165}, // STXBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453555254534d48ULL, 0x43ULL}, 594}, // HMSTRUSDC
+    {{0x435442415441ULL, 0x0ULL}, 141}, // ATABTC
+    {{0x4354424e4157ULL, 0x0ULL}, 1332}, // WANBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445544556ULL, 0x0ULL}, 1319}, // VETETH
+    {{0x5952544c5841ULL, 0x0ULL}, 174}, // AXLTRY
+    {{0x435442454e4fULL, 0x0ULL}, 872}, // ONEBTC
+    {{0x4254414330303031ULL, 0x424eULL}, 0}, // 1000CATBNB
+    {{0x435442434e4bULL, 0x0ULL}, 692}, // KNCBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254594d53414aULL, 0x0ULL}, 653}, // JASMYTRY
+    {{0x59525459424142ULL, 0x0ULL}, 184}, // BABYTRY
+    {{0x4453555245505948ULL, 0x54ULL}, 604}, // HYPERUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442494e4d4fULL, 0x0ULL}, 861}, // OMNIBTC
+    {{0x435442544142ULL, 0x0ULL}, 202}, // BATBTC
+    {{0x535544464143524fULL, 0x44ULL}, 888}, // ORCAFDUSD
+    {{0x434453555a4843ULL, 0x0ULL}, 324}, // CHZUSDC
+    {{0x52415a54445355ULL, 0x0ULL}, 1298}, // USDTZAR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544b5aULL, 0x0ULL}, 1424}, // ZKTRY
+    {{0x4453555055525953ULL, 0x54ULL}, 1201}, // SYRUPUSDT
+    {{0x4854454d45455453ULL, 0x0ULL}, 1143}, // STEEMETH
+    {{0x595254424b43ULL, 0x0ULL}, 328}, // CKBTRY
+    {{0x54445355584d49ULL, 0x0ULL}, 623}, // IMXUSDT
+    {{0x435442454f4aULL, 0x0ULL}, 655}, // JOEBTC
+    {{0x4354424b5aULL, 0x0ULL}, 1422}, // ZKBTC
+    {{0x424e424c4f53ULL, 0x0ULL}, 1121}, // SOLBNB
+    {{0x59525433495041ULL, 0x0ULL}, 100}, // API3TRY
+    {{0x55444655474e4550ULL, 0x4453ULL}, 915}, // PENGUFDUSD
+    {{0x544453554b525453ULL, 0x0ULL}, 1162}, // STRKUSDT
+    {{0x535544464f564541ULL, 0x44ULL}, 56}, // AEVOFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554f474c41ULL, 0x0ULL}, 72}, // ALGOUSDC
+    {{0x595254504d41ULL, 0x0ULL}, 85}, // AMPTRY
+    {{0x424e425245425943ULL, 0x0ULL}, 356}, // CYBERBNB
+    {{0x5952544e4f54ULL, 0x0ULL}, 1236}, // TONTRY
+    {{0x54445355525352ULL, 0x0ULL}, 1043}, // RSRUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5544464c4c454853ULL, 0x4453ULL}, 1090}, // SHELLFDUSD
+    {{0x435442474759ULL, 0x0ULL}, 1408}, // YGGBTC
+    {{0x435442524b4dULL, 0x0ULL}, 791}, // MKRBTC
+    {{0x4d4f52444f4c4556ULL, 0x4344535545ULL}, 1315}, // VELODROMEUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554b5aULL, 0x0ULL}, 1426}, // ZKUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554d4f5250ULL, 0x0ULL}, 975}, // PROMUSDT
+    {{0x4354425241ULL, 0x0ULL}, 115}, // ARBTC
+    {{0x5444535556554aULL, 0x0ULL}, 669}, // JUVUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424f444f44ULL, 0x0ULL}, 378}, // DODOBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355494158ULL, 0x0ULL}, 1370}, // XAIUSDT
+    {{0x485445505258ULL, 0x0ULL}, 1386}, // XRPETH
+    {{0x52554542494853ULL, 0x0ULL}, 1096}, // SHIBEUR
+    {{0x504f4354445355ULL, 0x0ULL}, 1292}, // USDTCOP
+    {{0x54445355544e4544ULL, 0x0ULL}, 371}, // DENTUSDT
+    {{0x59525450554aULL, 0x0ULL}, 664}, // JUPTRY
+    {{0x54445355414850ULL, 0x0ULL}, 935}, // PHAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x48544548534144ULL, 0x0ULL}, 363}, // DASHETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e425a4843ULL, 0x0ULL}, 321}, // CHZBNB
+    {{0x5444535544535558ULL, 0x0ULL}, 1398}, // XUSDUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442544e4fULL, 0x0ULL}, 877}, // ONTBTC
+    {{0x5444535558434c41ULL, 0x0ULL}, 69}, // ALCXUSDT
+    {{0x59504a435442ULL, 0x0ULL}, 282}, // BTCJPY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x434453554e474953ULL, 0x0ULL}, 1105}, // SIGNUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554a524f5453ULL, 0x54ULL}, 1152}, // STORJUSDT
+    {{0x54445355544f4eULL, 0x0ULL}, 845}, // NOTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424c41555355ULL, 0x0ULL}, 1301}, // USUALBTC
+    {{0x554446494b4f4c46ULL, 0x4453ULL}, 508}, // FLOKIFDUSD
+    {{0x43445355484342ULL, 0x0ULL}, 216}, // BCHUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x445355494b4f4c46ULL, 0x54ULL}, 511}, // FLOKIUSDT
+    {{0x445355444650464eULL, 0x0ULL}, 830}, // NFPFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355525950ULL, 0x0ULL}, 981}, // PYRUSDT
+    {{0x4e424c4144454148ULL, 0x42ULL}, 568}, // HAEDALBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544143524fULL, 0x0ULL}, 889}, // ORCATRY
+    {{0x445355454d494e41ULL, 0x54ULL}, 90}, // ANIMEUSDT
+    {{0x5355414e414e4142ULL, 0x5444ULL}, 197}, // BANANAUSDT
+    {{0x53555245444e4552ULL, 0x5444ULL}, 1021}, // RENDERUSDT
+    {{0x544453554f525aULL, 0x0ULL}, 1431}, // ZROUSDT
+    {{0x5544464f5249454eULL, 0x4453ULL}, 819}, // NEIROFDUSD
+    {{0x54445355415441ULL, 0x0ULL}, 142}, // ATAUSDT
+    {{0x5255454d4c58ULL, 0x0ULL}, 1375}, // XLMEUR
+    {{0x595254475658ULL, 0x0ULL}, 1400}, // XVGTRY
+    {{0x5544464e45474945ULL, 0x4453ULL}, 425}, // EIGENFDUSD
+    {{0x505258585254ULL, 0x0ULL}, 1259}, // TRXXRP
+    {{0x43544258564950ULL, 0x0ULL}, 939}, // PIVXBTC
+    {{0x54445355464c53ULL, 0x0ULL}, 1113}, // SLFUSDT
+    {{0x4344535543544cULL, 0x0ULL}, 747}, // LTCUSDC
+    {{0x43445355594152ULL, 0x0ULL}, 1005}, // RAYUSDC
+    {{0x4453554446444552ULL, 0x0ULL}, 1010}, // REDFDUSD
+    {{0x5952544d4fULL, 0x0ULL}, 866}, // OMTRY
+    {{0x5952544449ULL, 0x0ULL}, 618}, // IDTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355585453ULL, 0x0ULL}, 1169}, // STXUSDT
+    {{0x434453554f4942ULL, 0x0ULL}, 238}, // BIOUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453555149ULL, 0x0ULL}, 652}, // IQUSDT
+    {{0x485445414441ULL, 0x0ULL}, 44}, // ADAETH
+    {{0x43544248534144ULL, 0x0ULL}, 362}, // DASHBTC
+    {{0x43544254524353ULL, 0x0ULL}, 1071}, // SCRTBTC
+    {{0x525545495553ULL, 0x0ULL}, 1173}, // SUIEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424f434942ULL, 0x0ULL}, 230}, // BICOBTC
+    {{0x54445355544648ULL, 0x0ULL}, 583}, // HFTUSDT
+    {{0x595254494b4f4c46ULL, 0x0ULL}, 509}, // FLOKITRY
+    {{0x43544243524cULL, 0x0ULL}, 733}, // LRCBTC
+    {{0x485445544f44ULL, 0x0ULL}, 396}, // DOTETH
+    {{0x54445355544e42ULL, 0x0ULL}, 261}, // BNTUSDT
+    {{0x5444535544ULL, 0x0ULL}, 403}, // DUSDT
+    {{0x5355444645564948ULL, 0x44ULL}, 588}, // HIVEFDUSD
+    {{0x4446414e414e4142ULL, 0x445355ULL}, 192}, // BANANAFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355544f4eULL, 0x0ULL}, 844}, // NOTUSDC
+    {{0x4453554c4c454853ULL, 0x43ULL}, 1092}, // SHELLUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59504a484342ULL, 0x0ULL}, 214}, // BCHJPY
+    {{0x544453554f474c41ULL, 0x0ULL}, 73}, // ALGOUSDT
+    {{0x59525441544e414dULL, 0x0ULL}, 766}, // MANTATRY
+    {{0x4354424e5652ULL, 0x0ULL}, 1049}, // RVNBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442464952ULL, 0x0ULL}, 1027}, // RIFBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554f564541ULL, 0x0ULL}, 58}, // AEVOUSDT
+    {{0x44535554425241ULL, 0x0ULL}, 117}, // ARBTUSD
+    {{0x5444535557ULL, 0x0ULL}, 1367}, // WUSDT
+    {{0x494144485445ULL, 0x0ULL}, 462}, // ETHDAI
+    {{0x595254454d4f42ULL, 0x0ULL}, 264}, // BOMETRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424d4b5241ULL, 0x0ULL}, 124}, // ARKMBTC
+    {{0x544453554149414bULL, 0x0ULL}, 671}, // KAIAUSDT
+    {{0x544453554951ULL, 0x0ULL}, 987}, // QIUSDT
+    {{0x525545504349ULL, 0x0ULL}, 607}, // ICPEUR
+    {{0x435442414e494dULL, 0x0ULL}, 788}, // MINABTC
+    {{0x525545504fULL, 0x0ULL}, 883}, // OPEUR
+    {{0x4354424c4c454853ULL, 0x0ULL}, 1089}, // SHELLBTC
+    {{0x54445355424744ULL, 0x0ULL}, 375}, // DGBUSDT
+    {{0x5952544b4e494cULL, 0x0ULL}, 719}, // LINKTRY
+    {{0x435442504349ULL, 0x0ULL}, 605}, // ICPBTC
+    {{0x43544250464eULL, 0x0ULL}, 829}, // NFPBTC
+    {{0x4354424f444cULL, 0x0ULL}, 705}, // LDOBTC
+    {{0x4453554c4c454853ULL, 0x54ULL}, 1093}, // SHELLUSDT
+    {{0x4e42414e414e4142ULL, 0x42ULL}, 190}, // BANANABNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453555241ULL, 0x0ULL}, 136}, // ARUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254425254ULL, 0x0ULL}, 1240}, // TRBTRY
+    {{0x434453554b4e4f42ULL, 0x0ULL}, 270}, // BONKUSDC
+    {{0x44535544464e4f54ULL, 0x0ULL}, 1235}, // TONFDUSD
+    {{0x4453554f5249454eULL, 0x43ULL}, 821}, // NEIROUSDC
+    {{0x5952544f454eULL, 0x0ULL}, 824}, // NEOTRY
+    {{0x535544464b4e494cULL, 0x44ULL}, 717}, // LINKFDUSD
+    {{0x4453554154454854ULL, 0x54ULL}, 1216}, // THETAUSDT
+    {{0x435442524b4e41ULL, 0x0ULL}, 91}, // ANKRBTC
+    {{0x54445355383943ULL, 0x0ULL}, 294}, // C98USDT
+    {{0x4354424d4c46ULL, 0x0ULL}, 506}, // FLMBTC
+    {{0x595254524353ULL, 0x0ULL}, 1072}, // SCRTRY
+    {{0x4344535554ULL, 0x0ULL}, 1267}, // TUSDC
+    {{0x48544541544f49ULL, 0x0ULL}, 641}, // IOTAETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544f4942ULL, 0x0ULL}, 237}, // BIOTRY
+    {{0x434453554c494eULL, 0x0ULL}, 836}, // NILUSDC
+    {{0x424e424f5449414bULL, 0x0ULL}, 672}, // KAITOBNB
+    {{0x595254584f424dULL, 0x0ULL}, 775}, // MBOXTRY
+    {{0x485445534f45ULL, 0x0ULL}, 446}, // EOSETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355454854ULL, 0x0ULL}, 1219}, // THEUSDT
+    {{0x44535541544e414dULL, 0x54ULL}, 768}, // MANTAUSDT
+    {{0x54445355544142ULL, 0x0ULL}, 203}, // BATUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535552545341ULL, 0x0ULL}, 140}, // ASTRUSDT
+    {{0x5355444654554e50ULL, 0x44ULL}, 947}, // PNUTFDUSD
+    {{0x434453554d524f46ULL, 0x0ULL}, 517}, // FORMUSDC
+    {{0x55455245444e4552ULL, 0x52ULL}, 1017}, // RENDEREUR
+    {{0x43544258415641ULL, 0x0ULL}, 164}, // AVAXBTC
+    {{0x53554446414e4156ULL, 0x44ULL}, 1308}, // VANAFDUSD
+    {{0x544453554f454eULL, 0x0ULL}, 826}, // NEOUSDT
+    {{0x54445355565243ULL, 0x0ULL}, 347}, // CRVUSDT
+    {{0x4344535554504743ULL, 0x0ULL}, 315}, // CGPTUSDC
+    {{0x43445355534e45ULL, 0x0ULL}, 443}, // ENSUSDC
+    {{0x5355454c504f4550ULL, 0x4344ULL}, 922}, // PEOPLEUSDC
+    {{0x4354424f544cULL, 0x0ULL}, 749}, // LTOBTC
+    {{0x5444535543445355ULL, 0x0ULL}, 1288}, // USDCUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442455741ULL, 0x0ULL}, 171}, // AWEBTC
+    {{0x5255454e4957ULL, 0x0ULL}, 1355}, // WINEUR
+    {{0x424e42544556ULL, 0x0ULL}, 1317}, // VETBNB
+    {{0x54445355505853ULL, 0x0ULL}, 1191}, // SXPUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e424f5453ULL, 0x0ULL}, 1148}, // STOBNB
+    {{0x544453554e5953ULL, 0x0ULL}, 1198}, // SYNUSDT
+    {{0x59504a4c4f50ULL, 0x0ULL}, 957}, // POLJPY
+    {{0x4c5242424e42ULL, 0x0ULL}, 249}, // BNBBRL
+    {{0x43544249544f43ULL, 0x0ULL}, 338}, // COTIBTC
+    {{0x4453554446425241ULL, 0x0ULL}, 114}, // ARBFDUSD
+    {{0x4354424854524f46ULL, 0x0ULL}, 519}, // FORTHBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x485445584441ULL, 0x0ULL}, 52}, // ADXETH
+    {{0x445355454d494e41ULL, 0x43ULL}, 89}, // ANIMEUSDC
+    {{0x4354424d555451ULL, 0x0ULL}, 992}, // QTUMBTC
+    {{0x4c4f534c4f534e42ULL, 0x0ULL}, 259}, // BNSOLSOL
+    {{0x485445434c52ULL, 0x0ULL}, 1030}, // RLCETH
+    {{0x535545494b4f4f43ULL, 0x5444ULL}, 335}, // COOKIEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544e474953ULL, 0x0ULL}, 1104}, // SIGNTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535543495045ULL, 0x0ULL}, 452}, // EPICUSDT
+    {{0x43445355455041ULL, 0x0ULL}, 97}, // APEUSDC
+    {{0x544e4f4954435541ULL, 0x5952ULL}, 154}, // AUCTIONTRY
+    {{0x595254414441ULL, 0x0ULL}, 48}, // ADATRY
+    {{0x5444535545534f52ULL, 0x0ULL}, 1038}, // ROSEUSDT
+    {{0x54445355545853ULL, 0x0ULL}, 1196}, // SXTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355414c4147ULL, 0x0ULL}, 531}, // GALAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x525545505258ULL, 0x0ULL}, 1387}, // XRPEUR
+    {{0x54445355504d41ULL, 0x0ULL}, 86}, // AMPUSDT
+    {{0x5952544a524f5453ULL, 0x0ULL}, 1151}, // STORJTRY
+    {{0x5952544f444e4fULL, 0x0ULL}, 869}, // ONDOTRY
+    {{0x5444535552554c42ULL, 0x0ULL}, 242}, // BLURUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525456414dULL, 0x0ULL}, 772}, // MAVTRY
+    {{0x4354424f525aULL, 0x0ULL}, 1427}, // ZROBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554b535544ULL, 0x0ULL}, 405}, // DUSKUSDT
+    {{0x54445355444c4745ULL, 0x0ULL}, 423}, // EGLDUSDT
+    {{0x4453554946485445ULL, 0x43ULL}, 468}, // ETHFIUSDC
+    {{0x4354425a4843ULL, 0x0ULL}, 322}, // CHZBTC
+    {{0x54445355525545ULL, 0x0ULL}, 482}, // EURUSDT
+    {{0x424e4241474153ULL, 0x0ULL}, 1052}, // SAGABNB
+    {{0x43445355435442ULL, 0x0ULL}, 289}, // BTCUSDC
+    {{0x4354424156414bULL, 0x0ULL}, 679}, // KAVABTC
+    {{0x445355444650554aULL, 0x0ULL}, 663}, // JUPFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446535047ULL, 0x0ULL}, 550}, // GPSFDUSD
+    {{0x435442454b4142ULL, 0x0ULL}, 187}, // BAKEBTC
+    {{0x435442494548ULL, 0x0ULL}, 579}, // HEIBTC
+    {{0x5544465245505948ULL, 0x4453ULL}, 601}, // HYPERFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535558554c46ULL, 0x0ULL}, 515}, // FLUXUSDT
+    {{0x44535544464f5453ULL, 0x0ULL}, 1149}, // STOFDUSD
+    {{0x43445355544c41ULL, 0x0ULL}, 83}, // ALTUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x445355524559414cULL, 0x43ULL}, 701}, // LAYERUSDC
+    {{0x595254454d494e41ULL, 0x0ULL}, 88}, // ANIMETRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453555954514cULL, 0x0ULL}, 732}, // LQTYUSDT
+    {{0x4453554154454854ULL, 0x43ULL}, 1215}, // THETAUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355525352ULL, 0x0ULL}, 1042}, // RSRUSDC
+    {{0x4c5242495553ULL, 0x0ULL}, 1171}, // SUIBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525447584150ULL, 0x0ULL}, 907}, // PAXGTRY
+    {{0x43445355545853ULL, 0x0ULL}, 1195}, // SXTUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e4f4954435541ULL, 0x4354ULL}, 152}, // AUCTIONBTC
+    {{0x4453554446584341ULL, 0x0ULL}, 37}, // ACXFDUSD
+    {{0x595254495553ULL, 0x0ULL}, 1176}, // SUITRY
+    {{0x424e424b4e494cULL, 0x0ULL}, 712}, // LINKBNB
+    {{0x5952545355544543ULL, 0x0ULL}, 308}, // CETUSTRY
+    {{0x43544241524542ULL, 0x0ULL}, 225}, // BERABTC
+    {{0x5255454c4f50ULL, 0x0ULL}, 955}, // POLEUR
+    {{0x3353414e414e4142ULL, 0x4344535531ULL}, 193}, // BANANAS31USDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525448474948ULL, 0x0ULL}, 585}, // HIGHTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525452564f4dULL, 0x0ULL}, 803}, // MOVRTRY
+    {{0x53555849444e5550ULL, 0x4344ULL}, 978}, // PUNDIXUSDC
+    {{0x44535544464f4942ULL, 0x0ULL}, 236}, // BIOFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355584341ULL, 0x0ULL}, 40}, // ACXUSDT
+    {{0x5355454c504f4550ULL, 0x5444ULL}, 923}, // PEOPLEUSDT
+    {{0x544453554e5652ULL, 0x0ULL}, 1051}, // RVNUSDT
+    {{0x4354424f49ULL, 0x0ULL}, 637}, // IOBTC
+    {{0x43445355425241ULL, 0x0ULL}, 118}, // ARBUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525458594c4f50ULL, 0x0ULL}, 962}, // POLYXTRY
+    {{0x43544250584157ULL, 0x0ULL}, 1334}, // WAXPBTC
+    {{0x5355444645564141ULL, 0x44ULL}, 19}, // AAVEFDUSD
+    {{0x43445355444c4745ULL, 0x0ULL}, 422}, // EGLDUSDC
+    {{0x4354424e494e4f52ULL, 0x0ULL}, 1032}, // RONINBTC
+    {{0x494c4f43434f5242ULL, 0x54445355343137ULL}, 273}, // BROCCOLI714USDT
+    {{0x544453554c424dULL, 0x0ULL}, 774}, // MBLUSDT
+    {{0x54445355564c4f53ULL, 0x0ULL}, 1136}, // SOLVUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x445355584d414542ULL, 0x43ULL}, 219}, // BEAMXUSDC
+    {{0x595254434e554cULL, 0x0ULL}, 755}, // LUNCTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4c52425241454eULL, 0x0ULL}, 810}, // NEARBRL
+    {{0x59525445504550ULL, 0x0ULL}, 928}, // PEPETRY
+    {{0x54445355484342ULL, 0x0ULL}, 217}, // BCHUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554f54524f50ULL, 0x54ULL}, 971}, // PORTOUSDT
+    {{0x5355444645504550ULL, 0x44ULL}, 926}, // PEPEFDUSD
+    {{0x44535559524e4156ULL, 0x43ULL}, 1313}, // VANRYUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355494548ULL, 0x0ULL}, 581}, // HEIUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442535953ULL, 0x0ULL}, 1202}, // SYSBTC
+    {{0x4354424f58454eULL, 0x0ULL}, 827}, // NEXOBTC
+    {{0x435442505258ULL, 0x0ULL}, 1385}, // XRPBTC
+    {{0x435442544546ULL, 0x0ULL}, 488}, // FETBTC
+    {{0x54445355555254ULL, 0x0ULL}, 1250}, // TRUUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254534e45ULL, 0x0ULL}, 442}, // ENSTRY
+    {{0x595254585453ULL, 0x0ULL}, 1167}, // STXTRY
+    {{0x485445454e5552ULL, 0x0ULL}, 1045}, // RUNEETH
+    {{0x595254544341ULL, 0x0ULL}, 34}, // ACTTRY
+    {{0x4354424a4e49ULL, 0x0ULL}, 630}, // INJBTC
+    {{0x434453554e5547ULL, 0x0ULL}, 565}, // GUNUSDC
+    {{0x54445355444c57ULL, 0x0ULL}, 1363}, // WLDUSDT
+    {{0x434453554242ULL, 0x0ULL}, 208}, // BBUSDC
+    {{0x544453554c544dULL, 0x0ULL}, 806}, // MTLUSDT
+    {{0x544453554d4b5241ULL, 0x0ULL}, 128}, // ARKMUSDT
+    {{0x525545444c57ULL, 0x0ULL}, 1359}, // WLDEUR
+    {{0x59525441524542ULL, 0x0ULL}, 227}, // BERATRY
+    {{0x445355544c4f53ULL, 0x0ULL}, 1130}, // SOLTUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453555a4843ULL, 0x0ULL}, 325}, // CHZUSDT
+    {{0x54445355414d55ULL, 0x0ULL}, 1276}, // UMAUSDT
+    {{0x4354424f564541ULL, 0x0ULL}, 55}, // AEVOBTC
+    {{0x595254494e55ULL, 0x0ULL}, 1280}, // UNITRY
+    {{0x4453555355544543ULL, 0x43ULL}, 309}, // CETUSUSDC
+    {{0x59525441444946ULL, 0x0ULL}, 494}, // FIDATRY
+    {{0x544453554d534bULL, 0x0ULL}, 696}, // KSMUSDT
+    {{0x54445355575342ULL, 0x0ULL}, 275}, // BSWUSDT
+    {{0x59504a45474f44ULL, 0x0ULL}, 384}, // DOGEJPY
+    {{0x4453555245505553ULL, 0x54ULL}, 1183}, // SUPERUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554b5241ULL, 0x0ULL}, 130}, // ARKUSDT
+    {{0x59504a45504550ULL, 0x0ULL}, 927}, // PEPEJPY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4354424c544dULL, 0x0ULL}, 805}, // MTLBTC
+    {{0x53554c454e52454bULL, 0x4344ULL}, 686}, // KERNELUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e424242ULL, 0x0ULL}, 204}, // BBBNB
+    {{0x485445494e55ULL, 0x0ULL}, 1278}, // UNIETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x59525458445944ULL, 0x0ULL}, 408}, // DYDXTRY
+    {{0x43544257ULL, 0x0ULL}, 1338}, // WBTC
+    {{0x5554414330303031ULL, 0x544453ULL}, 4}, // 1000CATUSDT
+    {{0x4344535556554aULL, 0x0ULL}, 668}, // JUVUSDC
+    {{0x424e424941ULL, 0x0ULL}, 61}, // AIBNB
+    {{0x44465245444e4552ULL, 0x445355ULL}, 1018}, // RENDERFDUSD
+    {{0x544453554f4d534fULL, 0x0ULL}, 898}, // OSMOUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x52554559424142ULL, 0x0ULL}, 182}, // BABYEUR
+    {{0x544453554c5841ULL, 0x0ULL}, 175}, // AXLUSDT
+    {{0x435442464c53ULL, 0x0ULL}, 1110}, // SLFBTC
+    {{0x445355504d555254ULL, 0x54ULL}, 1248}, // TRUMPUSDT
+    {{0x435442514552ULL, 0x0ULL}, 1022}, // REQBTC
+    {{0x5952544e52544eULL, 0x0ULL}, 847}, // NTRNTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446414441ULL, 0x0ULL}, 46}, // ADAFDUSD
+    {{0x595254484341ULL, 0x0ULL}, 28}, // ACHTRY
+    {{0x435442585254ULL, 0x0ULL}, 1252}, // TRXBTC
+    {{0x544453554b4e4f42ULL, 0x0ULL}, 271}, // BONKUSDT
+    {{0x595254414954ULL, 0x0ULL}, 1222}, // TIATRY
+    {{0x5952544946485445ULL, 0x0ULL}, 467}, // ETHFITRY
+    {{0x5444535549544f43ULL, 0x0ULL}, 340}, // COTIUSDT
+    {{0x4344535558454449ULL, 0x0ULL}, 616}, // IDEXUSDC
+    {{0x595254544357ULL, 0x0ULL}, 1344}, // WCTTRY
+    {{0x544453554944524fULL, 0x0ULL}, 896}, // ORDIUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254434956ULL, 0x0ULL}, 1324}, // VICTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355544e4452ULL, 0x0ULL}, 1008}, // RDNTUSDT
+    {{0x43544243544cULL, 0x0ULL}, 741}, // LTCBTC
+    {{0x5952544154454854ULL, 0x0ULL}, 1214}, // THETATRY
+    {{0x435442544e51ULL, 0x0ULL}, 989}, // QNTBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952544c4542ULL, 0x0ULL}, 222}, // BELTRY
+    {{0x5952544944524fULL, 0x0ULL}, 894}, // ORDITRY
+    {{0x434453554944524fULL, 0x0ULL}, 895}, // ORDIUSDC
+    {{0x544453554f434942ULL, 0x0ULL}, 231}, // BICOUSDT
+    {{0x434453554c4946ULL, 0x0ULL}, 500}, // FILUSDC
+    {{0x5952544f485456ULL, 0x0ULL}, 1330}, // VTHOTRY
+    {{0x5952544d534bULL, 0x0ULL}, 695}, // KSMTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535558564950ULL, 0x0ULL}, 940}, // PIVXUSDT
+    {{0x435442424e42ULL, 0x0ULL}, 250}, // BNBBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554f5449414bULL, 0x54ULL}, 678}, // KAITOUSDT
+    {{0x4354425241454eULL, 0x0ULL}, 811}, // NEARBTC
+    {{0x424e424954524150ULL, 0x0ULL}, 901}, // PARTIBNB
+    {{0x5444535554534f49ULL, 0x0ULL}, 639}, // IOSTUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355454d4f42ULL, 0x0ULL}, 265}, // BOMEUSDC
+    {{0x54445355564c49ULL, 0x0ULL}, 621}, // ILVUSDT
+    {{0x485445504c53ULL, 0x0ULL}, 1114}, // SLPETH
+    {{0x4c5242504d555254ULL, 0x0ULL}, 1243}, // TRUMPBRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544241544144ULL, 0x0ULL}, 365}, // DATABTC
+    {{0x5952544e474fULL, 0x0ULL}, 856}, // OGNTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355495553ULL, 0x0ULL}, 1177}, // SUIUSDC
+    {{0x485445565353ULL, 0x0ULL}, 1140}, // SSVETH
+    {{0x544453554c4f50ULL, 0x0ULL}, 960}, // POLUSDT
+    {{0x54445355544e51ULL, 0x0ULL}, 991}, // QNTUSDT
+    {{0x4f44594241424d31ULL, 0x434453554547ULL}, 15}, // 1MBABYDOGEUSDC
+    {{0x525545435442ULL, 0x0ULL}, 279}, // BTCEUR
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5952545245425943ULL, 0x0ULL}, 360}, // CYBERTRY
+    {{0x4453554148504c41ULL, 0x54ULL}, 76}, // ALPHAUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535541524542ULL, 0x0ULL}, 229}, // BERAUSDT
+    {{0x5952544954524150ULL, 0x0ULL}, 903}, // PARTITRY
+    {{0x54424c4154524f50ULL, 0x43ULL}, 966}, // PORTALBTC
+    {{0x5444535559424142ULL, 0x0ULL}, 186}, // BABYUSDT
+    {{0x4854454c4f50ULL, 0x0ULL}, 954}, // POLETH
+    {{0x435442444552ULL, 0x0ULL}, 1009}, // REDBTC
+    {{0x54445355494659ULL, 0x0ULL}, 1407}, // YFIUSDT
+    {{0x554b41524142554dULL, 0x434453ULL}, 807}, // MUBARAKUSDC
+    {{0x52544c4144454148ULL, 0x59ULL}, 570}, // HAEDALTRY
+    {{0x595254545754ULL, 0x0ULL}, 1272}, // TWTTRY
+    {{0x595254574f43ULL, 0x0ULL}, 341}, // COWTRY
+    {{0x434453554c5052ULL, 0x0ULL}, 1039}, // RPLUSDC
+    {{0x4453554446544c41ULL, 0x0ULL}, 81}, // ALTFDUSD
+    {{0x5952545055525953ULL, 0x0ULL}, 1199}, // SYRUPTRY
+    {{0x595254464c53ULL, 0x0ULL}, 1111}, // SLFTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e4252414248ULL, 0x0ULL}, 573}, // HBARBNB
+    {{0x54445355454e4fULL, 0x0ULL}, 874}, // ONEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254544f48ULL, 0x0ULL}, 598}, // HOTTRY
+    {{0x5952544d4c58ULL, 0x0ULL}, 1378}, // XLMTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535558454449ULL, 0x0ULL}, 617}, // IDEXUSDT
+    {{0x54445355535047ULL, 0x0ULL}, 553}, // GPSUSDT
+    {{0x5355454e49504c41ULL, 0x5444ULL}, 78}, // ALPINEUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355574f43ULL, 0x0ULL}, 343}, // COWUSDT
+    {{0x43445355444e4153ULL, 0x0ULL}, 1061}, // SANDUSDC
+    {{0x595254414c4147ULL, 0x0ULL}, 529}, // GALATRY
+    {{0x59504a58544f49ULL, 0x0ULL}, 648}, // IOTXJPY
+    {{0x43544245564141ULL, 0x0ULL}, 17}, // AAVEBTC
+    {{0x595254455041ULL, 0x0ULL}, 96}, // APETRY
+    {{0x5254454c504f4550ULL, 0x59ULL}, 921}, // PEOPLETRY
+    {{0x43445355484341ULL, 0x0ULL}, 29}, // ACHUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4344535547584150ULL, 0x0ULL}, 908}, // PAXGUSDC
+    {{0x544453554a4e49ULL, 0x0ULL}, 635}, // INJUSDT
+    {{0x595254414341ULL, 0x0ULL}, 23}, // ACATRY
+    {{0x595254504d555254ULL, 0x0ULL}, 1246}, // TRUMPTRY
+    {{0x43445355584d47ULL, 0x0ULL}, 545}, // GMXUSDC
+    {{0x44535544464f544aULL, 0x0ULL}, 659}, // JTOFDUSD
+    {{0x4453554c41555355ULL, 0x54ULL}, 1305}, // USUALUSDT
+    {{0x4354424f4e58ULL, 0x0ULL}, 1381}, // XNOBTC
+    {{0x595254485445ULL, 0x0ULL}, 473}, // ETHTRY
+    {{0x435442524d4eULL, 0x0ULL}, 840}, // NMRBTC
+    {{0x4c5242414c4147ULL, 0x0ULL}, 524}, // GALABRL
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x595254414e494dULL, 0x0ULL}, 789}, // MINATRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544256414dULL, 0x0ULL}, 771}, // MAVBTC
+    {{0x435442474e4fULL, 0x0ULL}, 875}, // ONGBTC
+    {{0x5952544e5547ULL, 0x0ULL}, 564}, // GUNTRY
+    {{0x5952545442584941ULL, 0x0ULL}, 66}, // AIXBTTRY
+    {{0x5952544f49445541ULL, 0x0ULL}, 158}, // AUDIOTRY
+    {{0x4854454353ULL, 0x0ULL}, 1068}, // SCETH
+    {{0x5952544e5652ULL, 0x0ULL}, 1050}, // RVNTRY
+    {{0x5544464e494e4f52ULL, 0x4453ULL}, 1033}, // RONINFDUSD
+    {{0x59525454554e50ULL, 0x0ULL}, 948}, // PNUTTRY
+    {{0x4453554446414e45ULL, 0x0ULL}, 432}, // ENAFDUSD
+    {{0x424e42415453494cULL, 0x0ULL}, 722}, // LISTABNB
+    {{0x494c4f43434f5242ULL, 0x43445355343137ULL}, 272}, // BROCCOLI714USDC
+    {{0x43445355414e45ULL, 0x0ULL}, 434}, // ENAUSDC
+    {{0x43445355544e4fULL, 0x0ULL}, 879}, // ONTUSDC
+    {{0x5442534f544e4153ULL, 0x43ULL}, 1063}, // SANTOSBTC
+    {{0x4453554446464957ULL, 0x0ULL}, 1351}, // WIFFDUSD
+    {{0x544453555a5458ULL, 0x0ULL}, 1397}, // XTZUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x53524154445355ULL, 0x0ULL}, 1290}, // USDTARS
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43445355414e4156ULL, 0x0ULL}, 1310}, // VANAUSDC
+    {{0x54445355524b4dULL, 0x0ULL}, 794}, // MKRUSDT
+    {{0x4e4c50485445ULL, 0x0ULL}, 472}, // ETHPLN
+    {{0x4453554c45584f56ULL, 0x54ULL}, 1329}, // VOXELUSDT
+    {{0x544453554156414bULL, 0x0ULL}, 680}, // KAVAUSDT
+    {{0x595254535047ULL, 0x0ULL}, 551}, // GPSTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355425241ULL, 0x0ULL}, 119}, // ARBUSDT
+    {{0x595254425241ULL, 0x0ULL}, 116}, // ARBTRY
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x44535544464c4f53ULL, 0x0ULL}, 1126}, // SOLFDUSD
+    {{0x535544464e474953ULL, 0x44ULL}, 1103}, // SIGNFDUSD
+    {{0x544453554e5553ULL, 0x0ULL}, 1180}, // SUNUSDT
+    {{0x43445355585453ULL, 0x0ULL}, 1168}, // STXUSDC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x435442545041ULL, 0x0ULL}, 103}, // APTBTC
+    {{0x485445544f48ULL, 0x0ULL}, 597}, // HOTETH
+    {{0x424e42564c4f53ULL, 0x0ULL}, 1133}, // SOLVBNB
+    {{0x5255454c4f53ULL, 0x0ULL}, 1125}, // SOLEUR
+    {{0x4c52424b4e494cULL, 0x0ULL}, 713}, // LINKBRL
+    {{0x4854454a4e49ULL, 0x0ULL}, 631}, // INJETH
+    {{0x595254535841ULL, 0x0ULL}, 179}, // AXSTRY
+    {{0x595254534f45ULL, 0x0ULL}, 448}, // EOSTRY
+    {{0x544453554d5441ULL, 0x0ULL}, 144}, // ATMUSDT
+    {{0x4453554c4c455053ULL, 0x54ULL}, 1138}, // SPELLUSDT
+    {{0x445355584d414542ULL, 0x54ULL}, 220}, // BEAMXUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355464952ULL, 0x0ULL}, 1028}, // RIFUSDT
+    {{0x44535544464f444cULL, 0x0ULL}, 706}, // LDOFDUSD
+    {{0x435442544648ULL, 0x0ULL}, 582}, // HFTBTC
+    {{0x59525454494e49ULL, 0x0ULL}, 626}, // INITTRY
+    {{0x435442424850ULL, 0x0ULL}, 936}, // PHBBTC
+    {{0x4453554446414954ULL, 0x0ULL}, 1221}, // TIAFDUSD
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x544453554c495aULL, 0x0ULL}, 1421}, // ZILUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x4453554446585254ULL, 0x0ULL}, 1255}, // TRXFDUSD
+    {{0x48544552574f50ULL, 0x0ULL}, 973}, // POWRETH
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x5444535531445355ULL, 0x0ULL}, 1283}, // USD1USDT
+    {{0x595254454341ULL, 0x0ULL}, 25}, // ACETRY
+    {{0x53554446454d4f42ULL, 0x44ULL}, 263}, // BOMEFDUSD
+    {{0x595254524556454cULL, 0x0ULL}, 710}, // LEVERTRY
+    {{0x5355444659424142ULL, 0x44ULL}, 183}, // BABYFDUSD
+    {{0x5952545241ULL, 0x0ULL}, 134}, // ARTRY
+    {{0x544453554d4fULL, 0x0ULL}, 868}, // OMUSDT
+    {{0x595254474fULL, 0x0ULL}, 858}, // OGTRY
+    {{0x435442484341ULL, 0x0ULL}, 27}, // ACHBTC
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x424e4258415641ULL, 0x0ULL}, 162}, // AVAXBNB
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x43544254584fULL, 0x0ULL}, 899}, // OXTBTC
+    {{0x525545454d4f42ULL, 0x0ULL}, 262}, // BOMEEUR
+    {{0x5952544f5249454eULL, 0x0ULL}, 820}, // NEIROTRY
+    {{0x5444535541444946ULL, 0x0ULL}, 495}, // FIDAUSDT
+    {{0x544453555241454eULL, 0x0ULL}, 818}, // NEARUSDT
+    {{0x0ULL, 0x0ULL}, -1},
+    {{0x54445355504fULL, 0x0ULL}, 887}, // OPUSDT
+    {{0x544453554d4c54ULL, 0x0ULL}, 1229}, // TLMUSDT
+    {{0x54445355594152ULL, 0x0ULL}, 1006}, // RAYUSDT
+    {{0x54445355514552ULL, 0x0ULL}, 1023}, // REQUSDT
+};
+
+} // namespace symbol_perfect_hash
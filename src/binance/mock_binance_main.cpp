@@ -1,4 +1,5 @@
 #include "book_ticker/book_ticker_parser.hpp" // defines parse_book_ticker
+#include "book_ticker/book_ticker_topic.hpp"
 #include "book_ticker/stream_config.hpp"
 #include "book_ticker/symbol_id_map.hpp" // defines load_symbol_map
 #include <chrono>
@@ -56,9 +57,11 @@ int main(int argc, char **argv) {
   for (const auto &[key, value] : filtered_map) {
     std::cout << key << " " << value << std::endl;
   }
+  SymbolLookup symbol_lookup = make_symbol_lookup(filtered_map);
   zmq::context_t context(1);
   zmq::socket_t socket(context, zmq::socket_type::pub);
   socket.bind("tcp://0.0.0.0:5555");
+  BookTickerTopicPublisher publisher(socket, 1);
   std::cerr << "🧪 ZMQ PUB bound to tcp://0.0.0.0:5555\n";
 
   std::this_thread::sleep_for(
@@ -75,15 +78,13 @@ int main(int argc, char **argv) {
       continue;
 
     try {
-      if (parse_book_ticker(parser, json_str, ticker, true, &filtered_map)) {
+      if (parse_book_ticker(parser, json_str, ticker, true, &symbol_lookup)) {
         ticker.my_receive_time_ns =
             std::chrono::duration_cast<std::chrono::nanoseconds>(
                 std::chrono::system_clock::now().time_since_epoch())
                 .count();
 
-        zmq::message_t zmq_msg(sizeof(BookTicker));
-        std::memcpy(zmq_msg.data(), &ticker, sizeof(BookTicker));
-        socket.send(zmq_msg, zmq::send_flags::none);
+        publisher.publish(&ticker, 1);
 
         std::cout << "📤 Sent BookTicker: id=" << ticker.id << "\n";
       } else {
@@ -1,4 +1,5 @@
 #include "book_ticker/book_ticker.hpp" // ✅ canonical struct
+#include "book_ticker/book_ticker_topic.hpp"
 #include <chrono>
 #include <cstring>
 #include <iostream>
@@ -11,6 +12,7 @@ int main() {
 
   // Bind to same port as real producer
   socket.bind("tcp://0.0.0.0:5555");
+  BookTickerTopicPublisher publisher(socket, 1);
   std::cerr << "🧪 Mock producer ZMQ PUB bound to tcp://0.0.0.0:5555\n";
 
   // Allow time for consumers to connect
@@ -34,11 +36,8 @@ int main() {
             std::chrono::system_clock::now().time_since_epoch())
             .count();
 
-    zmq::message_t zmq_msg(sizeof(BookTicker));
-    std::memcpy(zmq_msg.data(), &msg, sizeof(BookTicker));
-
     std::cout << "📤 Sending BookTicker id=" << msg.id << std::endl;
-    socket.send(zmq_msg, zmq::send_flags::none);
+    publisher.publish(&msg, 1);
 
     std::this_thread::sleep_for(std::chrono::seconds(1));
   }
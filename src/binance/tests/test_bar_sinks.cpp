@@ -0,0 +1,272 @@
+#include "bars/bar_aggregator_impl.hpp"
+#include "bars/bar_report_printer.hpp"
+#include "bars/bar_sinks.hpp"
+#include "bars/slot_bar_aggregator_impl.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// The ostringstream row format the report used before to_chars.
+std::string legacy_row(const std::string &symbol, const OHLCBar &bar) {
+  std::ostringstream oss;
+  oss << std::left << std::setw(10) << symbol << std::right << std::fixed
+      << std::setprecision(2) << std::setw(10) << bar.open << std::setw(10)
+      << bar.high << std::setw(10) << bar.low << std::setw(10) << bar.close
+      << std::setw(10) << bar.count;
+  return oss.str();
+}
+
+std::string legacy_header() {
+  std::ostringstream oss;
+  oss << std::left << std::setw(10) << "Symbol" << std::right << std::setw(10)
+      << "Open" << std::setw(10) << "High" << std::setw(10) << "Low"
+      << std::setw(10) << "Close" << std::setw(10) << "Count";
+  return oss.str();
+}
+
+/// The previous report: collect (name, bar) pairs, sort, format each row.
+std::string legacy_report(std::span<const OHLCBar> bars,
+                          const std::vector<std::string> &names) {
+  std::vector<std::pair<std::string, const OHLCBar *>> rows;
+  for (size_t slot = 0; slot < bars.size(); ++slot) {
+    if (bars[slot].count)
+      rows.emplace_back(names[slot], &bars[slot]);
+  }
+  if (rows.empty())
+    return {};
+  std::sort(rows.begin(), rows.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+  std::ostringstream os;
+  os << legacy_header() << '\n';
+  for (const auto &[symbol, bar] : rows)
+    os << legacy_row(symbol, *bar) << '\n';
+  return os.str();
+}
+
+/// 100-ish symbols with dense slots.
+SymbolIdMap make_symbols(int n) {
+  SymbolIdMap symbols;
+  for (int i = 0; i < n; ++i)
+    symbols.emplace("SYM" + std::to_string((i * 37) % n) + "USDT", i * 3 + 1);
+  return symbols;
+}
+
+/// One completed window of @p slots random bars, some slots empty.
+std::vector<OHLCBar> make_window(size_t slots, std::mt19937_64 &rng) {
+  std::vector<OHLCBar> bars(slots);
+  for (size_t s = 0; s < slots; ++s) {
+    if (rng() % 4 == 0)
+      continue;
+    double base = std::ldexp(static_cast<double>(rng() % 100'000),
+                             static_cast<int>(rng() % 30) - 10);
+    for (int k = 0; k < 1 + static_cast<int>(rng() % 5); ++k)
+      bars[s].update(base * (1 + (static_cast<double>(rng() % 200) - 100) *
+                                     1e-4),
+                     1'750'000'000'000 + k);
+    bars[s].start_time_ms = 1'750'000'000'000;
+    bars[s].end_time_ms = 1'750'000'001'000;
+  }
+  return bars;
+}
+
+void check_row_format() {
+  std::mt19937_64 rng(1);
+  const double specials[] = {0.0,  0.005, 2.675, -0.001, 1e20,
+                             NAN,  -NAN,  INFINITY, 105131.895};
+  for (double v : specials) {
+    OHLCBar bar;
+    bar.update(v, 0);
+    check(format_ohlc_row("BTCUSDT", bar) == legacy_row("BTCUSDT", bar),
+          "special value formats like ostringstream");
+  }
+  for (int i = 0; i < 100'000; ++i) {
+    OHLCBar bar;
+    bar.update(std::ldexp(static_cast<double>(rng() % 10'000'000),
+                          static_cast<int>(rng() % 40) - 20),
+               0);
+    bar.update(static_cast<double>(rng() % 1'000'000) / 1000.0, 0);
+    std::string symbol(1 + rng() % 14, 'X');
+    if (format_ohlc_row(symbol, bar) != legacy_row(symbol, bar)) {
+      check(false, "random row formats like ostringstream");
+      return;
+    }
+  }
+  check(format_ohlc_header() == legacy_header(), "header");
+}
+
+void check_sinks() {
+  const SymbolIdMap symbols = make_symbols(120);
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  const std::vector<std::string> names = symbol_slot_names(slots);
+  std::mt19937_64 rng(2);
+  std::vector<std::vector<OHLCBar>> windows;
+  for (int w = 0; w < 3; ++w)
+    windows.push_back(make_window(names.size(), rng));
+
+  std::ostringstream text, csv, bin;
+  TextBarSink text_sink(text, slots);
+  CsvBarSink csv_sink(csv, slots);
+  BinaryBarSink bin_sink(bin, slots, 1'000, BarPriceSource::Micro);
+  std::string expected_text;
+  size_t expected_rows = 0;
+  for (const auto &window : windows) {
+    for (BarSink *sink :
+         std::initializer_list<BarSink *>{&text_sink, &csv_sink, &bin_sink})
+      sink->write(window);
+    expected_text += legacy_report(window, names);
+    expected_rows += static_cast<size_t>(
+        std::count_if(window.begin(), window.end(),
+                      [](const OHLCBar &b) { return b.count > 0; }));
+  }
+  text_sink.write(std::vector<OHLCBar>(names.size())); // nothing to report
+  check(text.str() == expected_text, "text sink matches the legacy report");
+
+  // CSV reads back to the exact doubles
+  std::istringstream in(csv.str());
+  std::string line;
+  std::getline(in, line);
+  check(line == "symbol,start_time_ms,end_time_ms,open,high,low,close,count",
+        "csv header");
+  size_t rows = 0, exact = 0;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string symbol, field;
+    std::getline(fields, symbol, ',');
+    std::vector<std::string> values;
+    while (std::getline(fields, field, ','))
+      values.push_back(field);
+    ++rows;
+    auto it = slots.find(symbol);
+    if (it == slots.end() || values.size() != 7)
+      continue;
+    for (const auto &window : windows) {
+      const OHLCBar &b = window[it->second.slot];
+      if (b.count && std::strtod(values[2].c_str(), nullptr) == b.open &&
+          std::strtod(values[3].c_str(), nullptr) == b.high &&
+          std::strtod(values[4].c_str(), nullptr) == b.low &&
+          std::strtod(values[5].c_str(), nullptr) == b.close &&
+          std::stoull(values[6]) == b.count) {
+        ++exact;
+        break;
+      }
+    }
+  }
+  check(rows == expected_rows && exact == rows, "csv rows read back exactly");
+
+  // Binary: an array of BarMessage
+  const std::string raw = bin.str();
+  check(raw.size() == expected_rows * sizeof(BarMessage),
+        "one 64-byte record per bar");
+  std::vector<BarMessage> records(raw.size() / sizeof(BarMessage));
+  std::memcpy(records.data(), raw.data(), raw.size());
+  size_t matched = 0, w = 0;
+  uint16_t last_slot = 0;
+  for (const BarMessage &r : records) {
+    if (&r != &records[0] && r.slot <= last_slot)
+      ++w; // slot order restarts with each window
+    last_slot = r.slot;
+    if (w >= windows.size())
+      break;
+    const OHLCBar &b = windows[w][r.slot];
+    matched += b.count == r.count && b.open == r.open &&
+               b.close == r.close && r.interval_ms == 1'000 &&
+               r.price_source == BarPriceSource::Micro &&
+               symbols.find(names[r.slot])->second == r.id;
+  }
+  check(matched == records.size(), "binary records read back");
+}
+
+void check_printer() {
+  const SymbolIdMap symbols = make_symbols(50);
+  BarAggregator agg(1'000);
+  std::mt19937_64 rng(4);
+  // BarAggregator opens its first window at the wall clock
+  int64_t ts = std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+  agg.update(1, 1.0, ts);
+  for (int i = 0; i < 5'000; ++i) {
+    auto it = std::next(symbols.begin(), static_cast<long>(rng() % 50));
+    agg.update(it->second, 100.0 + static_cast<double>(rng() % 1000) / 7,
+               ts + 1'000 + i / 10);
+  }
+  // Roll the window that holds the loop's ticks
+  agg.update(1, 1.0, ts + 10'000);
+  std::ostringstream out;
+  BarReportPrinter(symbols).print(agg, out);
+
+  std::vector<std::pair<std::string, OHLCBar>> rows;
+  for (const auto &[symbol, id] : symbols) {
+    auto it = agg.consume_completed_bars().find(id);
+    if (it != agg.consume_completed_bars().end())
+      rows.emplace_back(symbol, it->second);
+  }
+  std::sort(rows.begin(), rows.end(),
+            [](const auto &a, const auto &b) { return a.first < b.first; });
+  std::string expected = legacy_header() + '\n';
+  for (const auto &[symbol, bar] : rows)
+    expected += legacy_row(symbol, bar) + '\n';
+  check(!rows.empty() && out.str() == expected,
+        "BarReportPrinter output unchanged");
+}
+
+/// Cost of one 1s report over 400 symbols, legacy vs TextBarSink.
+void benchmark() {
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+  const SymbolIdMap symbols = make_symbols(400);
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  const std::vector<std::string> names = symbol_slot_names(slots);
+  std::mt19937_64 rng(5);
+  const std::vector<OHLCBar> window = make_window(names.size(), rng);
+  constexpr int kReports = 2'000;
+
+  std::ostringstream sink_a, sink_b, sink_c;
+  auto start = clock::now();
+  for (int i = 0; i < kReports; ++i) {
+    sink_a << legacy_report(window, names);
+    sink_a.str({});
+  }
+  auto mid = clock::now();
+  TextBarSink text(sink_b, slots);
+  for (int i = 0; i < kReports; ++i) {
+    text.write(window);
+    sink_b.str({});
+  }
+  auto mid2 = clock::now();
+  BinaryBarSink bin(sink_c, slots, 1'000);
+  for (int i = 0; i < kReports; ++i) {
+    bin.write(window);
+    sink_c.str({});
+  }
+  auto end = clock::now();
+
+  auto us = [](auto d) {
+    return duration_cast<nanoseconds>(d).count() / 1000.0 / kReports;
+  };
+  std::cout << "400-symbol report: ostringstream + sort " << us(mid - start)
+            << " us, TextBarSink " << us(mid2 - mid) << " us, BinaryBarSink "
+            << us(end - mid2) << " us\n";
+}
+
+int main() {
+  check_row_format();
+  check_sinks();
+  check_printer();
+  benchmark();
+
+  std::cout << (failures ? "bar sink checks FAILED\n"
+                         : "bar sink checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+#include "bars_stage.hpp"
+#include "book_ticker.hpp"
+#include "book_ticker_scanner.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/// Equal up to rounding: -march=native may contract the micro / weighted
+/// price formulas into FMAs differently in different call sites.
+bool near(double a, double b) {
+  return std::abs(a - b) <= 1e-12 * std::abs(a);
+}
+
+void check_config_parsing() {
+  BarsConfig cfg;
+  check(parse_bars_config("micro", cfg) && cfg.enabled &&
+            cfg.price == BarPriceSource::Micro &&
+            cfg.horizons_ms == std::vector<int64_t>{60'000},
+        "price source only, default interval");
+  check(parse_bars_config("wgt:1s,1m,5m,1h", cfg) &&
+            cfg.price == BarPriceSource::Weighted &&
+            cfg.horizons_ms ==
+                std::vector<int64_t>{1'000, 60'000, 300'000, 3'600'000},
+        "interval list");
+  check(parse_bars_config("mid:250ms,500", cfg) &&
+            cfg.horizons_ms == std::vector<int64_t>{250, 500},
+        "ms intervals");
+  check(!parse_bars_config("last:1m", cfg), "unknown price source");
+  check(!parse_bars_config("mid:1m,90s", cfg), "horizons must nest");
+  check(!parse_bars_config("mid:", cfg) && !parse_bars_config("mid:5x", cfg),
+        "malformed interval");
+  check(cfg.horizons_ms == std::vector<int64_t>{250, 500},
+        "failed parse leaves the config alone");
+}
+
+/**
+ * @brief Pushes the sample through a BarsStage and compares every published
+ * bar with bars computed directly from the tickers' event times.
+ */
+void check_sample_bars(const std::vector<std::string> &frames,
+                       const SymbolIdMap &symbols, BarPriceSource source) {
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  SymbolLookup lookup = make_symbol_lookup(slots);
+  const int64_t day = 1'749'945'600'000; // UTC day of the sample
+  const std::vector<int64_t> horizons = {250, 1'000};
+
+  std::vector<BookTicker> tickers;
+  simdjson::ondemand::parser parser;
+  BookTicker bt{};
+  for (const auto &frame : frames) {
+    if (parse_book_ticker_ec(ParserKind::Fixed, parser, frame, bt, false,
+                             &lookup) != ParseStatus::Ok)
+      continue;
+    bt.my_receive_time_ns = (day + bt.event_time_ms_midnight) * 1'000'000;
+    tickers.push_back(bt);
+  }
+
+  // (horizon, window start, slot) → bar; a window opens when event time
+  // reaches its start, and ticks a little late (E order differs across
+  // symbols) count toward the window that is open
+  std::map<std::tuple<int64_t, int64_t, uint16_t>, OHLCBar> expected;
+  std::vector<int64_t> open_window(horizons.size(), INT64_MIN / 2);
+  for (const BookTicker &t : tickers) {
+    int64_t ts = day + t.event_time_ms_midnight;
+    for (size_t h = 0; h < horizons.size(); ++h) {
+      if (ts >= open_window[h] + horizons[h])
+        open_window[h] = ts / horizons[h] * horizons[h];
+      expected[{horizons[h], open_window[h], t.slot}].update(
+          bar_price(t, source), ts);
+    }
+  }
+
+  BarsConfig cfg;
+  cfg.price = source;
+  cfg.horizons_ms = horizons;
+  BarsStage stage(cfg, symbol_slot_count(slots));
+  std::vector<BarMessage> published;
+  auto collect = [&](std::span<const BarMessage> bars) {
+    published.insert(published.end(), bars.begin(), bars.end());
+  };
+  for (size_t i = 0; i < tickers.size(); i += 100) {
+    stage.push(&tickers[i], std::min<size_t>(100, tickers.size() - i));
+    stage.process(collect);
+  }
+  // A tick well past the end closes every window
+  BookTicker last = tickers.back();
+  last.event_time_ms_midnight += 10'000;
+  stage.push(&last, 1);
+  stage.process(collect);
+
+  check(stage.tickers() == tickers.size() + 1 && stage.dropped() == 0,
+        "every ticker aggregated");
+  check(published.size() == expected.size() &&
+            stage.bars() == published.size(),
+        "one bar per (horizon, window, symbol) with ticks");
+  size_t mismatches = 0;
+  for (const BarMessage &msg : published) {
+    auto it = expected.find({msg.interval_ms, msg.start_time_ms, msg.slot});
+    if (it == expected.end() || !near(it->second.open, msg.open) ||
+        !near(it->second.high, msg.high) || !near(it->second.low, msg.low) ||
+        !near(it->second.close, msg.close) || it->second.count != msg.count ||
+        msg.end_time_ms != msg.start_time_ms + msg.interval_ms ||
+        msg.price_source != source ||
+        symbols.find(symbol_slot_names(slots)[msg.slot])->second != msg.id)
+      ++mismatches;
+  }
+  check(mismatches == 0, "published bars match the direct computation");
+  std::cout << to_string(source) << ": " << tickers.size() << " tickers -> "
+            << published.size() << " bars\n";
+}
+
+/// A consumer that outruns the bars thread drops instead of waiting.
+void check_overflow(const SymbolIdMap &symbols) {
+  BarsConfig cfg;
+  BarsStage stage(cfg, symbols.size());
+  std::vector<BookTicker> burst(SpscBookTickerQueue::kCapacity + 10);
+  for (BookTicker &t : burst) {
+    t = BookTicker{};
+    t.bid_price = t.ask_price = 1.0;
+  }
+  stage.push(burst.data(), burst.size());
+  check(stage.dropped() == 10, "overflow counted as dropped");
+
+  // Undefined micro price (both qtys zero) is skipped, not aggregated
+  BarsConfig micro;
+  parse_bars_config("micro", micro);
+  BarsStage micro_stage(micro, symbols.size());
+  micro_stage.push(burst.data(), 1);
+  micro_stage.process([](std::span<const BarMessage>) {});
+  check(!std::isfinite(bar_price(burst[0], BarPriceSource::Micro)),
+        "micro price undefined without qty");
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0] << " <sample.json> <symbols.json>\n";
+    return 1;
+  }
+  auto frames = get_data(argv[1]);
+  SymbolIdMap symbols; // frames carry uppercase symbols
+  for (const auto &[symbol, id] : load_symbol_map(argv[2]))
+    symbols.emplace(to_upper(symbol), id);
+
+  check_config_parsing();
+  check_sample_bars(frames, symbols, BarPriceSource::Mid);
+  check_sample_bars(frames, symbols, BarPriceSource::Micro);
+  check_overflow(symbols);
+  std::cout << (failures ? "bars stage checks FAILED\n"
+                         : "bars stage checks passed\n");
+  return failures ? 1 : 0;
+}
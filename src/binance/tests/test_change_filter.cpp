@@ -0,0 +1,180 @@
+#include "book_ticker.hpp"
+#include "book_ticker_parser.hpp"
+#include "change_filter.hpp"
+#include "fixed_book_ticker.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+BookTicker quote(double bid, double bid_qty, double ask, double ask_qty,
+                 int64_t update_id) {
+  BookTicker bt{};
+  bt.bid_price = bid;
+  bt.bid_qty = bid_qty;
+  bt.ask_price = ask;
+  bt.ask_qty = ask_qty;
+  bt.update_id = update_id;
+  return bt;
+}
+
+/// Runs a fixed sequence through each policy and checks which updates pass.
+void check_policies() {
+  ChangeFilterConfig cfg;
+  check(parse_change_filter("qty:0.1,flag", cfg), "parse qty:0.1,flag");
+  check(cfg.policy == ChangePolicy::Qty && cfg.action == ChangeAction::Flag &&
+            cfg.qty_threshold == 0.1,
+        "qty:0.1,flag fields");
+  check(!parse_change_filter("price:0.1", cfg), "threshold only for qty");
+  check(!parse_change_filter("qty:x", cfg), "bad threshold rejected");
+  check(!parse_change_filter("any,drop", cfg), "bad action rejected");
+
+  const std::vector<BookTicker> seq = {
+      quote(100, 10, 101, 10, 1),   // first: always passes
+      quote(100, 10, 101, 10, 2),   // only u changed
+      quote(100, 10.5, 101, 10, 3), // bid qty +5%
+      quote(100, 12, 101, 10, 4),   // bid qty +20% vs last published
+      quote(100.5, 12, 101, 10, 5), // bid price moved
+  };
+  struct Case {
+    const char *spec;
+    std::vector<bool> expect;
+  };
+  const Case cases[] = {
+      {"off", {true, true, true, true, true}},
+      {"any", {true, false, true, true, true}},
+      {"price", {true, false, false, false, true}},
+      {"qty:0.1", {true, false, false, true, true}},
+      {"price,flag", {true, true, true, true, true}},
+  };
+  for (const Case &c : cases) {
+    parse_change_filter(c.spec, cfg);
+    BookTickerChangeFilter filter(cfg, 1);
+    for (size_t i = 0; i < seq.size(); ++i) {
+      if (filter.accept(seq[i]) != c.expect[i]) {
+        std::cerr << "FAILED: policy " << c.spec << " update " << i << "\n";
+        ++failures;
+      }
+    }
+  }
+
+  parse_change_filter("price", cfg);
+  BookTickerChangeFilter filter(cfg, 1);
+  std::vector<BookTicker> batch = seq;
+  size_t kept = filter.filter(batch.data(), batch.size());
+  check(kept == 2 && batch[1].update_id == 5, "filter compacts in order");
+  check(filter.seen(0) == 5 && filter.suppressed(0) == 3,
+        "per-symbol counters");
+}
+
+/// A qty move of exactly the threshold is not a move in lots.
+void check_qty_tie() {
+  ChangeFilterConfig cfg;
+  parse_change_filter("qty:0.05", cfg);
+  BasicChangeFilter<FixedBookTicker> filter(cfg, 1);
+  FixedBookTicker f[2]{};
+  f[0].bid_qty = 12'240'000'000; // 122.40
+  f[1].bid_qty = 12'852'000'000; // 128.52, +5%
+  f[1].update_id = 1;
+  check(filter.filter(f, 2) == 1,
+        "a qty move equal to the threshold is dropped");
+}
+
+/**
+ * @brief Runs captured frames through the double and the fixed-point
+ * (`--prices fixed`, default 8/8 scales) filters: both must keep the same
+ * updates.
+ */
+void check_fixed_filter(const std::vector<std::string> &frames,
+                        const SymbolIdMap &symbols) {
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  SymbolLookup lookup = make_symbol_lookup(slots);
+  SymbolScaleTable scales;
+  simdjson::ondemand::parser parser;
+  std::vector<BookTicker> doubles;
+  std::vector<FixedBookTicker> fixed;
+  for (const auto &frame : frames) {
+    BookTicker bt{};
+    FixedBookTicker fx{};
+    if (parse_book_ticker_ec(parser, frame, bt, false, &lookup) !=
+        ParseStatus::Ok)
+      continue;
+    if (parse_book_ticker_fixed_point(parser, frame, fx, false, &lookup,
+                                      scales) != ParseStatus::Ok) {
+      check(false, "every sample price fits the default scale");
+      return;
+    }
+    doubles.push_back(bt);
+    fixed.push_back(fx);
+  }
+
+  // qty:0.05 ties exactly in the sample (SOLUSDT 122.40 -> 128.52), where
+  // the double subtraction rounds either way; see check_qty_tie
+  for (const char *spec : {"any", "price", "qty:0.0537"}) {
+    ChangeFilterConfig cfg;
+    parse_change_filter(spec, cfg);
+    BookTickerChangeFilter double_filter(cfg, symbol_slot_count(slots));
+    BasicChangeFilter<FixedBookTicker> fixed_filter(cfg,
+                                                    symbol_slot_count(slots));
+    std::vector<BookTicker> d = doubles;
+    std::vector<FixedBookTicker> f = fixed;
+    size_t kept = double_filter.filter(d.data(), d.size());
+    bool same = kept == fixed_filter.filter(f.data(), f.size());
+    for (size_t i = 0; same && i < kept; ++i) {
+      BookTicker wire = to_book_ticker(f[i], scales[f[i].id]);
+      same = wire.update_id == d[i].update_id && same_top_of_book(wire, d[i]);
+    }
+    std::cout << "[fixed filter " << spec << "] kept " << kept << "/"
+              << doubles.size() << "\n";
+    if (!same)
+      std::cerr << "❌ fixed change filter " << spec
+                << " keeps different updates\n";
+    failures += !same;
+  }
+}
+
+/// Replays captured frames through each policy and reports suppression.
+void replay(const std::vector<std::string> &frames,
+            const SymbolIdMap &symbols) {
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  SymbolLookup lookup = make_symbol_lookup(slots);
+  simdjson::ondemand::parser parser;
+  std::vector<BookTicker> tickers;
+  BookTicker bt{};
+  for (const auto &frame : frames) {
+    if (parse_book_ticker_ec(parser, frame, bt, false, &lookup) ==
+        ParseStatus::Ok)
+      tickers.push_back(bt);
+  }
+  const std::vector<std::string> names = symbol_slot_names(slots);
+  for (const char *spec : {"any", "price", "qty:0.05", "qty:0.5"}) {
+    ChangeFilterConfig cfg;
+    parse_change_filter(spec, cfg);
+    BookTickerChangeFilter filter(cfg, names.size());
+    std::vector<BookTicker> batch = tickers;
+    size_t kept = filter.filter(batch.data(), batch.size());
+    std::cout << "--filter " << spec << ": published " << kept << "/"
+              << tickers.size() << "\n";
+    filter.print(std::cout, [&](size_t slot) { return names[slot]; });
+  }
+}
+
+int main(int argc, char **argv) {
+  check_policies();
+  check_qty_tie();
+  if (argc > 2) {
+    std::vector<std::string> frames = get_data(argv[1]);
+    SymbolIdMap symbols; // frames carry uppercase symbols
+    for (const auto &[symbol, id] : load_symbol_map(argv[2]))
+      symbols.emplace(to_upper(symbol), id);
+    replay(frames, symbols);
+    check_fixed_filter(frames, symbols);
+  } else {
+    std::cerr << "Usage: " << argv[0]
+              << " [<sample.json> <symbols.json>] (replay skipped)\n";
+  }
+  std::cout << (failures ? "change filter checks FAILED\n"
+                         : "change filter checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -1,25 +1,62 @@
 #include "common/time_utils.hpp"
+#include "common/tsc_clock.hpp"
+#include <cstdlib>
 #include <iostream>
 
-void benchmark_clock_calls() {
+template <typename Clock>
+void benchmark_clock_calls(const char *label, Clock &&clock_fn) {
   constexpr int N = 1'000'000;
 
   auto start = std::chrono::high_resolution_clock::now();
 
   volatile int64_t sink = 0; // prevent optimization
   for (int i = 0; i < N; ++i) {
-    sink = sink + now_ns_since_epoch();
+    sink = sink + clock_fn();
   }
 
   auto end = std::chrono::high_resolution_clock::now();
   auto duration_ns =
       std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
-  std::cout << "Total time: " << duration_ns << " ns\n";
-  std::cout << "Average time per call: " << (duration_ns / N) << " ns\n";
+  std::cout << label << " total time: " << duration_ns << " ns\n";
+  std::cout << label << " average time per call: " << (duration_ns / N)
+            << " ns\n";
+}
+
+/// Compares TSC-derived timestamps with system_clock over @p rounds samples.
+void check_tsc_offset(const TscClock &tsc, int rounds) {
+  int64_t max_abs = 0;
+  for (int i = 0; i < rounds; ++i) {
+    int64_t a = now_ns_since_epoch();
+    int64_t t = tsc.now_ns();
+    int64_t b = now_ns_since_epoch();
+    int64_t off = t - (a + (b - a) / 2);
+    max_abs = std::max(max_abs, std::abs(off));
+  }
+  std::cout << "max |tsc - chrono| over " << rounds << " samples: " << max_abs
+            << " ns\n";
 }
 
 int main() {
-  benchmark_clock_calls();
+  benchmark_clock_calls("chrono", [] { return now_ns_since_epoch(); });
+
+  TscClock tsc;
+  if (!tsc.calibrate()) {
+    std::cout << "no invariant TSC, skipping TSC benchmark\n";
+    return 0;
+  }
+  std::cout << "TSC rate: " << tsc.ticks_per_ns() << " ticks/ns\n";
+  benchmark_clock_calls("tsc", [&tsc] { return tsc.now_ns(); });
+  check_tsc_offset(tsc, 1000);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  tsc.resync();
+  std::cout << "error after 500 ms before resync: " << tsc.last_error_ns()
+            << " ns\n";
+  check_tsc_offset(tsc, 1000);
+
+  select_receive_clock(ClockSource::Tsc);
+  benchmark_clock_calls("receive_time_ns (tsc)",
+                        [] { return receive_time_ns(); });
   return 0;
 }
@@ -0,0 +1,125 @@
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/tsc_clock.hpp"
+#include "test_util.hpp"
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Bursts @p total updates round-robin over @p symbols IDs into a
+ * ConflatingBookTickerBuffer while a consumer that spends @p work_ns per
+ * ticker drains it.
+ *
+ * update_id is a per-symbol sequence and bid_price mirrors it, so the
+ * consumer can check that each symbol only moves forward, that values are
+ * never torn, and that the last value it sees is the last one written.
+ */
+void run(size_t symbols, int64_t total, int64_t work_ns) {
+  ConflatingBookTickerBuffer buffer(symbols);
+  std::atomic<bool> done{false};
+  std::vector<int64_t> last_seen(symbols, 0);
+  bool ordered = true;
+  bool consistent = true;
+  LatencyHistogram staleness;
+
+  std::thread consumer([&] {
+    BookTicker bt;
+    auto take = [&] {
+      if (!buffer.try_dequeue(bt))
+        return false;
+      staleness.record(receive_time_ns() - bt.my_receive_time_ns);
+      if (bt.update_id <= last_seen[bt.slot])
+        ordered = false;
+      if (bt.bid_price != static_cast<double>(bt.update_id))
+        consistent = false;
+      last_seen[bt.slot] = bt.update_id;
+      int64_t until = receive_time_ns() + work_ns;
+      while (receive_time_ns() < until) {
+      }
+      return true;
+    };
+    for (;;) {
+      if (take())
+        continue;
+      if (done.load(std::memory_order_acquire)) {
+        while (take()) {
+        }
+        break;
+      }
+    }
+  });
+
+  BookTicker bt{};
+  const int64_t per_symbol = total / static_cast<int64_t>(symbols);
+  for (int64_t seq = 1; seq <= per_symbol; ++seq) {
+    for (size_t id = 0; id < symbols; ++id) {
+      bt.slot = static_cast<uint16_t>(id);
+      bt.update_id = seq;
+      bt.bid_price = static_cast<double>(seq);
+      bt.my_receive_time_ns = receive_time_ns();
+      check(buffer.try_enqueue(bt), "enqueue never fails in range");
+    }
+    if (seq % 64 == 0)
+      std::this_thread::yield();
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+
+  bool final_values = true;
+  for (size_t id = 0; id < symbols; ++id)
+    final_values &= last_seen[id] == per_symbol;
+
+  bt.slot = static_cast<uint16_t>(symbols);
+  check(!buffer.try_enqueue(bt), "out-of-range slot rejected");
+  check(ordered, "each symbol only moves forward");
+  check(consistent, "no torn values");
+  check(final_values, "consumer ends on the last value of every symbol");
+  check(buffer.delivered() + buffer.conflated() == buffer.enqueued(),
+        "delivered + conflated == enqueued");
+
+  std::cout << "symbols=" << symbols << " work=" << work_ns << "ns\n  ";
+  buffer.print(std::cout);
+  staleness.print(std::cout, "  staleness");
+}
+
+/**
+ * @brief One hot key at slot 0 is rewritten before every single-item drain
+ * while the other keys wait: every dirty key must still be delivered within
+ * one pass over the bitmap.
+ */
+void check_fairness(size_t symbols) {
+  ConflatingBookTickerBuffer buffer(symbols);
+  BookTicker bt{};
+  for (size_t id = 0; id < symbols; ++id) {
+    bt.slot = static_cast<uint16_t>(id);
+    bt.update_id = 1;
+    buffer.try_enqueue(bt);
+  }
+  std::vector<bool> delivered(symbols, false);
+  BookTicker hot{};
+  for (size_t i = 0; i <= symbols; ++i) {
+    ++hot.update_id;
+    buffer.try_enqueue(hot);
+    if (buffer.try_dequeue_bulk(&bt, 1) == 1)
+      delivered[bt.slot] = true;
+  }
+  bool all = true;
+  for (bool d : delivered)
+    all &= d;
+  check(all, "a hot low slot does not starve the other keys");
+}
+
+int main() {
+  check_fairness(200);
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+  run(32, 2'000'000, 0);
+  run(32, 2'000'000, 2'000);
+  run(1434, 2'000'000, 500);
+  std::cout << (failures ? "conflation checks FAILED\n"
+                         : "conflation checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+#include "book_ticker.hpp"
+#include "book_ticker_scanner.hpp"
+#include "feed_arbiter.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Network model of one leg: fixed delay plus exponential jitter, and a drop
+/// probability.
+struct LegModel {
+  double delay_us;
+  double jitter_us;
+  double drop;
+};
+
+/**
+ * @brief Replays @p frames @p reps times as two local sources feeding the
+ * legs of an ArbitratedBookTickerQueue, and checks the merged output.
+ *
+ * Exchange time advances 10 µs per frame; each leg delivers in order (TCP)
+ * at exchange time + its modelled delay and stamps that as
+ * my_receive_time_ns. Both sources are paced on a shared replay clock that
+ * the consumer advances only once everything due has been enqueued, so the
+ * merge sees copies in arrival order regardless of thread scheduling.
+ *
+ * @param depth Updates the arbiter remembers per symbol; must cover how far
+ * (in updates of one symbol) the slower leg's copies can trail.
+ */
+void run(const std::vector<std::string> &frames, const SymbolIdMap &symbols,
+         int reps, LegModel a, LegModel b,
+         size_t depth = FeedArbiter::kDefaultDepth) {
+  const SymbolSlotMap slots = assign_symbol_slots(symbols);
+  const size_t span = symbol_slot_count(slots);
+  SymbolLookup lookup = make_symbol_lookup(slots);
+  ArbitratedBookTickerQueue queue(2, span, depth);
+
+  // Parse once; both legs replay the same updates
+  std::vector<BookTicker> updates;
+  simdjson::ondemand::parser parser;
+  BookTicker bt{};
+  for (int r = 0; r < reps; ++r) {
+    for (const auto &frame : frames) {
+      if (parse_book_ticker_ec(ParserKind::Fixed, parser, frame, bt, false,
+                               &lookup) != ParseStatus::Ok)
+        continue;
+      bt.update_id += static_cast<int64_t>(r) * 10'000'000'000'000;
+      updates.push_back(bt);
+    }
+  }
+  std::vector<int64_t> newest(span, 0);
+  for (const BookTicker &u : updates)
+    newest[u.slot] = u.update_id;
+
+  std::vector<int64_t> arrival[2];
+  std::vector<uint8_t> delivered[2];
+  const LegModel models[2] = {a, b};
+  for (int leg = 0; leg < 2; ++leg) {
+    std::mt19937_64 rng(42 + leg);
+    std::exponential_distribution<double> jitter(1.0 / models[leg].jitter_us);
+    std::bernoulli_distribution drop(models[leg].drop);
+    int64_t prev = 0;
+    for (size_t i = 0; i < updates.size(); ++i) {
+      double us = 10.0 * i + models[leg].delay_us + jitter(rng);
+      prev = std::max(prev, static_cast<int64_t>(us * 1000));
+      arrival[leg].push_back(prev);
+      delivered[leg].push_back(!drop(rng));
+    }
+  }
+
+  constexpr int64_t kDone = std::numeric_limits<int64_t>::max();
+  std::atomic<int64_t> clock{0};
+  std::atomic<int64_t> next_due[2] = {0, 0};
+  std::vector<std::thread> sources;
+  for (int leg = 0; leg < 2; ++leg) {
+    sources.emplace_back([&, leg] {
+      BookTicker t;
+      for (size_t i = 0; i < updates.size(); ++i) {
+        if (!delivered[leg][i])
+          continue;
+        next_due[leg].store(arrival[leg][i], std::memory_order_release);
+        while (clock.load(std::memory_order_acquire) < arrival[leg][i])
+          std::this_thread::yield();
+        t = updates[i];
+        t.my_receive_time_ns = arrival[leg][i];
+        while (!queue.leg(leg).try_enqueue(t))
+          std::this_thread::yield();
+      }
+      next_due[leg].store(kDone, std::memory_order_release);
+    });
+  }
+
+  std::vector<int64_t> last(span, 0);
+  std::vector<BookTicker> batch(64);
+  std::vector<int64_t> published_ids;
+  size_t published = 0;
+  bool ordered = true;
+  for (;;) {
+    const int64_t due = std::min(next_due[0].load(std::memory_order_acquire),
+                                 next_due[1].load(std::memory_order_acquire));
+    const bool caught_up = due > clock.load(std::memory_order_relaxed);
+    size_t n;
+    while ((n = queue.try_dequeue_bulk(batch.begin(), batch.size())) > 0) {
+      for (size_t i = 0; i < n; ++i) {
+        if (batch[i].update_id <= last[batch[i].slot])
+          ordered = false;
+        last[batch[i].slot] = batch[i].update_id;
+        published_ids.push_back(batch[i].update_id);
+      }
+      published += n;
+    }
+    if (!caught_up) {
+      std::this_thread::yield();
+      continue;
+    }
+    if (due == kDone)
+      break;
+    clock.store(due, std::memory_order_release);
+  }
+  for (auto &t : sources)
+    t.join();
+
+  // Copies of a published update beyond the first are duplicates; copies of
+  // an update that never got published (the other leg dropped it and had
+  // already delivered a newer one) are stale
+  std::sort(published_ids.begin(), published_ids.end());
+  size_t a_first = 0, late_copies = 0, stale_copies = 0;
+  for (size_t i = 0; i < updates.size(); ++i) {
+    a_first += delivered[0][i] && arrival[0][i] < arrival[1][i];
+    const size_t copies = delivered[0][i] + delivered[1][i];
+    if (std::binary_search(published_ids.begin(), published_ids.end(),
+                           updates[i].update_id))
+      late_copies += copies - 1;
+    else
+      stale_copies += copies;
+  }
+
+  const FeedArbiter &arb = queue.arbiter();
+  check(ordered, "published at most once, in update_id order per symbol");
+  check(last == newest, "latest update of every symbol published");
+  check(arb.won(0) + arb.won(1) == published, "wins add up");
+  check(arb.duplicate(0) + arb.duplicate(1) == late_copies,
+        "late copies of published updates count as duplicates");
+  check(arb.stale(0) + arb.stale(1) == stale_copies,
+        "copies of unpublished updates count as stale");
+  if (a.drop == 0 && b.drop == 0)
+    check(published == updates.size(), "lossless legs publish everything");
+  const size_t b_first = published - a_first;
+  check(a_first > b_first ? arb.won(0) > arb.won(1) : arb.won(0) < arb.won(1),
+        "the leg that arrived first more often wins more often");
+
+  std::cout << "leg A delay=" << a.delay_us << "us jitter=" << a.jitter_us
+            << "us drop=" << a.drop << " | leg B delay=" << b.delay_us
+            << "us jitter=" << b.jitter_us << "us\n"
+            << "  published " << published << "/" << updates.size()
+            << ", A first in " << a_first << " (model)\n";
+  arb.print(std::cout);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <sample.json> <symbols.json> [reps]\n";
+    return 1;
+  }
+  auto frames = get_data(argv[1]);
+  int reps = argc > 3 ? std::stoi(argv[3]) : 5;
+  SymbolIdMap symbols; // frames carry uppercase symbols
+  for (const auto &[symbol, id] : load_symbol_map(argv[2]))
+    symbols.emplace(to_upper(symbol), id);
+
+  // Equal legs, then A faster but lossy, then A slower with a jitter tail
+  run(frames, symbols, reps, {500, 50, 0.0}, {500, 50, 0.0});
+  run(frames, symbols, reps, {400, 50, 0.05}, {500, 50, 0.0});
+  // A's jitter tail trails B by up to ~2.5 ms, a couple of hundred updates
+  // of the sample's busiest symbols
+  run(frames, symbols, reps, {600, 300, 0.0}, {500, 20, 0.0}, 256);
+  std::cout << (failures ? "arbiter checks FAILED\n"
+                         : "arbiter checks passed\n");
+  return failures ? 1 : 0;
+}
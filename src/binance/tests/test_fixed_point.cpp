@@ -0,0 +1,168 @@
+#include "book_ticker.hpp"
+#include "book_ticker_scanner.hpp"
+#include "fixed_book_ticker.hpp"
+#include "common/fixed_point.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// Pulls the quoted price/qty strings out of each frame for number-only
+/// timing.
+std::vector<std::string> get_numbers(const std::vector<std::string> &lines) {
+  std::vector<std::string> numbers;
+  for (const auto &l : lines) {
+    for (const char *key : {R"("b":")", R"("B":")", R"("a":")", R"("A":")"}) {
+      size_t pos = l.find(key);
+      if (pos == std::string::npos)
+        continue;
+      pos += 5;
+      numbers.push_back(l.substr(pos, l.find('"', pos) - pos));
+    }
+  }
+  return numbers;
+}
+
+void check_round_trip(const std::vector<std::string> &lines) {
+  simdjson::ondemand::parser parser;
+  SymbolScaleTable scales;
+  size_t ok = 0, mismatch = 0;
+  for (const auto &l : lines) {
+    BookTicker bt;
+    FixedBookTicker fx;
+    if (!scan_book_ticker(l, bt, false, nullptr))
+      continue;
+    if (parse_book_ticker_fixed_point(parser, l, fx, false, nullptr,
+                                      scales) != ParseStatus::Ok) {
+      ++mismatch;
+      continue;
+    }
+    BookTicker back = to_book_ticker(fx, scales[-1]);
+    if (back.bid_price == bt.bid_price && back.ask_price == bt.ask_price &&
+        back.bid_qty == bt.bid_qty && back.ask_qty == bt.ask_qty &&
+        back.update_id == bt.update_id && back.trade_time == bt.trade_time)
+      ++ok;
+    else
+      ++mismatch;
+  }
+  std::cout << "[round-trip] ok=" << ok << " mismatch=" << mismatch << "\n\n";
+  check(ok > 0 && mismatch == 0, "fixed point round-trips to the double parse");
+}
+
+/// Statuses of the exception-free fixed-point parse.
+void check_status() {
+  const SymbolIdMap symbols{{"BTCUSDT", 0}};
+  const SymbolLookup lookup = make_symbol_lookup(symbols);
+  SymbolScaleTable scales;
+  scales.set(0, SymbolScale{2, 8});
+  simdjson::ondemand::parser parser;
+  FixedBookTicker fx;
+  auto status = [&](const std::string &s) {
+    return parse_book_ticker_fixed_point(parser, s, fx, false, &lookup, scales);
+  };
+  const std::string good =
+      R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"105131.90","B":"3.188",)"
+      R"("a":"105132.00","A":"12.773","T":1749978024759,"E":1749978024759})";
+  check(status(good) == ParseStatus::Ok && fx.bid_price == 10513190 &&
+            fx.ask_qty == 1277300000,
+        "fixed-layout frame at the BTCUSDT scale");
+  check(status(R"({"u":1,"s":"BTCUSDT","b":"1.5","B":"2","a":"1.6","A":"3",)"
+               R"("T":1,"E":1749978024759})") == ParseStatus::Ok &&
+            fx.bid_price == 150 && fx.bid_qty == 200000000,
+        "simdjson fallback frame");
+  check(status(R"({"result":null,"id":1})") == ParseStatus::ControlFrame,
+        "control frame");
+  check(status(R"({"e":"bookTicker","u":1,"s":"NOPEUSDT","b":"1"})") ==
+            ParseStatus::UnknownSymbol,
+        "unknown symbol");
+  check(status(R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"1.234",)"
+               R"("B":"1","a":"2","A":"1","T":1,"E":1})") ==
+            ParseStatus::MalformedNumber,
+        "price finer than the symbol scale");
+  check(status("not json") == ParseStatus::MalformedJson, "malformed json");
+}
+
+void time_numbers(const std::vector<std::string> &numbers) {
+  {
+    volatile double sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto &n : numbers) {
+      double v;
+      fast_float::from_chars(n.data(), n.data() + n.size(), v);
+      sink = sink + v;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << "[fast_float] Avg per number: "
+              << static_cast<double>(duration_ns) / numbers.size() << " ns\n";
+  }
+  {
+    volatile int64_t sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto &n : numbers) {
+      int64_t v = 0;
+      parse_fixed_decimal(n.data(), n.data() + n.size(), 8, v);
+      sink = sink + v;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << "[fixed]      Avg per number: "
+              << static_cast<double>(duration_ns) / numbers.size()
+              << " ns\n\n";
+  }
+}
+
+void time_frames(const std::vector<std::string> &lines) {
+  simdjson::ondemand::parser parser;
+  SymbolScaleTable scales;
+  {
+    BookTicker bt;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto &l : lines)
+      scan_book_ticker(l, bt, false, nullptr);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << "[double frame] Avg per message: "
+              << duration_ns / lines.size() << " ns\n";
+  }
+  {
+    FixedBookTicker fx;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto &l : lines)
+      parse_book_ticker_fixed_point(parser, l, fx, false, nullptr, scales);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << "[fixed frame]  Avg per message: "
+              << duration_ns / lines.size() << " ns\n\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <sample.json>\n";
+    return 1;
+  }
+  auto lines = get_data(argv[1]);
+  auto numbers = get_numbers(lines);
+  std::cout << "Loaded " << lines.size() << " JSON lines, " << numbers.size()
+            << " numbers.\n\n";
+  check_round_trip(lines);
+  check_status();
+  time_numbers(numbers);
+  time_numbers(numbers);
+  time_frames(lines);
+  time_frames(lines);
+  std::cout << (failures ? "fixed point checks FAILED\n"
+                         : "fixed point checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -1,6 +1,7 @@
 #include "book_ticker.hpp"
 #include "book_ticker_parser.hpp"
 #include "book_ticker_parser_nl.hpp"
+#include "book_ticker_scanner.hpp"
 #include "common/time_utils.hpp"
 #include <fstream>
 #include <iostream>
@@ -48,7 +49,11 @@ void time_simd(const std::vector<std::string> &lines) {
     simdjson::ondemand::parser parser;
     auto start = std::chrono::high_resolution_clock::now();
     for (const auto &l : lines) {
-      parse_book_ticker(parser, l, bt, false, nullptr);
+      try {
+        parse_book_ticker(parser, l, bt, false, nullptr);
+      } catch (const simdjson::simdjson_error &) {
+        // control frames such as {"result":null,"id":1}
+      }
     }
     auto end = std::chrono::high_resolution_clock::now();
     auto duration_ns =
@@ -56,7 +61,31 @@ void time_simd(const std::vector<std::string> &lines) {
             .count();
     std::cout << "[simdjson] Total time: " << duration_ns / 1e6 << " ms\n";
     std::cout << "[simdjson] Avg per message: " << duration_ns / lines.size()
-              << " ns\n";
+              << " ns\n\n";
+  }
+}
+
+void time_fixed(const std::vector<std::string> &lines) {
+  // Benchmark fixed-layout scanner (simdjson fallback on mismatch)
+  {
+    BookTicker bt;
+    simdjson::ondemand::parser parser;
+    size_t fallbacks = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto &l : lines) {
+      try {
+        parse_book_ticker(ParserKind::Fixed, parser, l, bt, false, nullptr);
+      } catch (const simdjson::simdjson_error &) {
+        ++fallbacks;
+      }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto duration_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    std::cout << "[fixed] Total time: " << duration_ns / 1e6 << " ms\n";
+    std::cout << "[fixed] Avg per message: " << duration_ns / lines.size()
+              << " ns (rejected " << fallbacks << ")\n\n";
   }
 }
 
@@ -65,8 +94,10 @@ int main(int argc, char **argv) {
   std::cout << "Loaded " << lines.size() << " JSON lines.\n\n";
   time_nl(lines);
   time_simd(lines);
+  time_fixed(lines);
   time_nl(lines);
   time_simd(lines);
+  time_fixed(lines);
 
   return 0;
 }
@@ -0,0 +1,175 @@
+#include "book_ticker.hpp"
+#include "book_ticker_scanner.hpp"
+#include "live_subscriptions.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+bool contains(const std::string &s, const std::string &part) {
+  return s.find(part) != std::string::npos;
+}
+
+/// Two fake connections recording what would have been sent on the socket.
+struct FakeConnections {
+  std::vector<std::string> sent[2];
+
+  void attach(LiveSubscriptions &subs, std::vector<std::string> a,
+              std::vector<std::string> b) {
+    subs.add_connection(a, [this](const std::string &f) {
+      sent[0].push_back(f);
+    });
+    subs.add_connection(b, [this](const std::string &f) {
+      sent[1].push_back(f);
+    });
+  }
+};
+
+/// Control requests against sharded and redundant connections.
+void check_requests(const SymbolIdMap &complete) {
+  SymbolIdMap initial =
+      filter_symbol_map(complete, {"btcusdt", "ethusdt", "solusdt"});
+  const SymbolSlotMap initial_slots = assign_symbol_slots(initial);
+  {
+    LiveSubscriptions subs(complete, initial, 8);
+    FakeConnections conns;
+    conns.attach(subs, {"btcusdt", "ethusdt"}, {"solusdt"});
+    const int32_t doge = complete.find("dogeusdt")->second;
+
+    check(find_symbol_id(subs.lookup(), "DOGEUSDT") < 0, "not yet subscribed");
+    check(subs.handle("subscribe DOGEUSDT") == "ok subscribed 1",
+          "subscribe reply");
+    check(find_symbol_id(subs.lookup(), "DOGEUSDT") == doge,
+          "lookup resolves the new symbol");
+    check(find_symbol(subs.lookup(), "DOGEUSDT").slot == 3 &&
+              subs.slots_used() == 4 && subs.slot_names()[3] == "DOGEUSDT",
+          "a new symbol takes the next dense slot");
+    check(conns.sent[0].empty() && conns.sent[1].size() == 1 &&
+              contains(conns.sent[1][0], "\"SUBSCRIBE\"") &&
+              contains(conns.sent[1][0], "dogeusdt@bookTicker"),
+          "SUBSCRIBE goes to the least-loaded shard only");
+    check(contains(subs.subscribe_message(1), "dogeusdt@bookTicker"),
+          "reconnect re-subscribes the added symbol");
+    check(subs.handle("subscribe dogeusdt") == "ok subscribed 0",
+          "already subscribed is skipped");
+    check(subs.handle("subscribe nosuchcoin") ==
+              "error unknown symbol nosuchcoin",
+          "unknown symbol rejected");
+    check(subs.handle("resubscribe btcusdt").starts_with("error usage"),
+          "bad verb rejected");
+
+    check(subs.handle("unsubscribe btcusdt") == "ok unsubscribed 1",
+          "unsubscribe reply");
+    check(find_symbol_id(subs.lookup(), "BTCUSDT") < 0,
+          "lookup drops the removed symbol");
+    check(conns.sent[0].size() == 1 &&
+              contains(conns.sent[0][0], "\"UNSUBSCRIBE\"") &&
+              contains(conns.sent[0][0], "btcusdt@bookTicker"),
+          "UNSUBSCRIBE goes to the owning shard");
+    check(!contains(subs.subscribe_message(0), "btcusdt"),
+          "reconnect no longer subscribes the removed symbol");
+    check(subs.size() == 3 && contains(subs.handle("list"), "DOGEUSDT"),
+          "list");
+    subs.handle("subscribe btcusdt");
+    check(find_symbol(subs.lookup(), "BTCUSDT").slot ==
+                  initial_slots.find("BTCUSDT")->second.slot &&
+              subs.slots_used() == 4,
+          "slot is stable across unsubscribe / subscribe");
+  }
+  {
+    LiveSubscriptions subs(complete, initial, 4);
+    FakeConnections conns;
+    conns.attach(subs, {"btcusdt", "ethusdt"}, {"solusdt"});
+    check(subs.handle("subscribe xrpusdt adausdt").starts_with(
+              "error no free slot"),
+          "subscribe beyond --max_symbols rejected");
+    check(find_symbol_id(subs.lookup(), "XRPUSDT") < 0 &&
+              subs.slots_used() == 3 && conns.sent[0].empty() &&
+              conns.sent[1].empty(),
+          "a rejected subscribe changes nothing");
+    check(subs.handle("subscribe xrpusdt") == "ok subscribed 1" &&
+              subs.slots_used() == 4,
+          "the last free slot can be taken");
+  }
+  {
+    LiveSubscriptions subs(complete, initial, 8, /*redundant=*/true);
+    FakeConnections conns;
+    conns.attach(subs, {"btcusdt", "ethusdt", "solusdt"},
+                 {"btcusdt", "ethusdt", "solusdt"});
+    subs.handle("subscribe xrpusdt adausdt");
+    subs.handle("unsubscribe ethusdt");
+    for (const auto &sent : conns.sent) {
+      check(sent.size() == 2 && contains(sent[0], "xrpusdt@bookTicker") &&
+                contains(sent[0], "adausdt@bookTicker") &&
+                contains(sent[1], "ethusdt@bookTicker"),
+            "every leg gets every (un)subscribe");
+    }
+  }
+}
+
+/**
+ * @brief Parses @p frames in a loop on a reader thread while the control side
+ * keeps adding and removing DOGEUSDT; the reader must never block or see a
+ * freed lookup, and every retired lookup must eventually be reclaimed.
+ */
+void check_swaps(const std::vector<std::string> &frames,
+                 const SymbolIdMap &complete, int swaps) {
+  std::vector<std::string> initial_subs = {"btcusdt", "ethusdt", "solusdt"};
+  LiveSubscriptions subs(complete, filter_symbol_map(complete, initial_subs),
+                         4);
+  const size_t conn = subs.add_connection(initial_subs, {});
+
+  std::atomic<bool> stop{false};
+  uint64_t doge_ok = 0, doge_unknown = 0, parsed = 0;
+  std::thread reader([&] {
+    simdjson::ondemand::parser parser;
+    BookTicker bt{};
+    while (!stop.load(std::memory_order_relaxed)) {
+      for (const auto &frame : frames) {
+        ParseStatus status = parse_book_ticker_ec(
+            ParserKind::Fixed, parser, frame, bt, false, &subs.lookup());
+        subs.quiescent(conn);
+        ++parsed;
+        if (frame.find("DOGEUSDT") == std::string::npos)
+          continue;
+        if (status == ParseStatus::Ok)
+          ++doge_ok;
+        else if (status == ParseStatus::UnknownSymbol)
+          ++doge_unknown;
+      }
+    }
+  });
+
+  for (int i = 0; i < swaps; ++i) {
+    subs.handle(i % 2 ? "unsubscribe dogeusdt" : "subscribe dogeusdt");
+    std::this_thread::yield();
+  }
+  stop = true;
+  reader.join();
+  subs.quiescent(conn);
+
+  check(doge_ok > 0 && doge_unknown > 0, "reader saw both versions");
+  check(subs.pending_reclaim() == 0, "all retired lookups reclaimed");
+  std::cout << swaps << " swaps under " << parsed << " parses: DOGEUSDT ok="
+            << doge_ok << " unknown_symbol=" << doge_unknown << "\n";
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <sample.json> <symbols.json> [swaps]\n";
+    return 1;
+  }
+  std::vector<std::string> frames = get_data(argv[1]);
+  SymbolIdMap complete = load_symbol_map(argv[2]);
+  int swaps = argc > 3 ? std::stoi(argv[3]) : 2000;
+
+  check_requests(complete);
+  check_swaps(frames, complete, swaps);
+  std::cout << (failures ? "live subscription checks FAILED\n"
+                         : "live subscription checks passed\n");
+  return failures ? 1 : 0;
+}
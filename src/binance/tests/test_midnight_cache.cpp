@@ -0,0 +1,93 @@
+#include "bars/bar_aggregator_impl.hpp"
+#include "common/time_utils.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+/// Walks across two UTC midnights (and one pre-epoch one) comparing the
+/// cached converter with the chrono-based reference.
+void check_crossing_midnight() {
+  const int64_t midnights[] = {1'750'032'000'000, // 2025-06-16 00:00:00 UTC
+                               1'750'118'400'000, 0};
+  UtcMidnightCache cache;
+  for (int64_t midnight : midnights) {
+    for (int64_t t = midnight - 5'000; t < midnight + 5'000; t += 7) {
+      if (cache.to_midnight_ms(t) != epoch_ms_to_midnight_ms_utc(t)) {
+        check(false, "to_midnight_ms mismatch near midnight");
+        return;
+      }
+    }
+    check(cache.day_start_ms() == midnight, "day start after crossing");
+  }
+
+  // Rebuilding epoch ms from intraday values, forward and a late tick back
+  cache.set_day(midnights[0] - 1'000);
+  check(cache.to_epoch_ms(86'399'500) == midnights[0] - 500, "same day");
+  check(cache.to_epoch_ms(100) == midnights[0] + 100, "rolled forward");
+  check(cache.to_epoch_ms(86'399'900) == midnights[0] - 100, "late tick");
+  check(cache.to_epoch_ms(200) == midnights[0] + 200, "back on new day");
+}
+
+/// Feeds intraday timestamps across midnight into a 1-minute BarAggregator.
+void check_bar_aggregator_midnight() {
+  BarAggregator agg(60'000);
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+  int64_t next_midnight = (now / kMsPerDay + 1) * kMsPerDay;
+
+  // Advance the aggregator's day to just before the next midnight
+  int32_t t = static_cast<int32_t>(kMsPerDay - 90'000);
+  for (int64_t ms = now % kMsPerDay; ms < t; ms += 3'600'000)
+    agg.update_intraday(1, 1.0, static_cast<int32_t>(ms));
+  agg.update_intraday(1, 1.0, t);
+  agg.clear_completed();
+
+  check(agg.update_intraday(1, 2.0, static_cast<int32_t>(kMsPerDay - 1)),
+        "rollover into last minute of day");
+  agg.clear_completed();
+  check(agg.update_intraday(1, 3.0, 5'000), "rollover at midnight");
+  const auto &bars = agg.consume_completed_bars();
+  auto it = bars.find(1);
+  check(it != bars.end() && it->second.close == 2.0 &&
+            it->second.end_time_ms == next_midnight,
+        "completed bar ends at midnight");
+}
+
+void benchmark_midnight() {
+  constexpr int N = 10'000'000;
+  const int64_t base = 1'750'032'000'000;
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  volatile int64_t sink = 0;
+  auto start = clock::now();
+  for (int i = 0; i < N; ++i)
+    sink = sink + epoch_ms_to_midnight_ms_utc(base + i);
+  auto mid = clock::now();
+  UtcMidnightCache cache;
+  for (int i = 0; i < N; ++i)
+    sink = sink + cache.to_midnight_ms(base + i);
+  auto end = clock::now();
+
+  std::cout << "chrono floor<days>: "
+            << duration_cast<nanoseconds>(mid - start).count() / double(N)
+            << " ns/call\n";
+  std::cout << "UtcMidnightCache:   "
+            << duration_cast<nanoseconds>(end - mid).count() / double(N)
+            << " ns/call\n";
+}
+
+int main() {
+  check_crossing_midnight();
+  check_bar_aggregator_midnight();
+  if (failures) {
+    std::cerr << failures << " check(s) failed\n";
+    return 1;
+  }
+  std::cout << "midnight checks passed\n";
+  benchmark_midnight();
+  return 0;
+}
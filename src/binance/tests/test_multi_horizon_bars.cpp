@@ -0,0 +1,180 @@
+#include "bars/multi_horizon_bar_aggregator_impl.hpp"
+#include "bars/slot_bar_aggregator_impl.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+struct Tick {
+  uint16_t slot;
+  double price;
+  int64_t ts;
+};
+
+/// Random-walk ticks over @p slots symbols from @p base, on average
+/// @p gap_ms apart, with an occasional quiet gap of several minutes.
+std::vector<Tick> make_ticks(size_t n, uint16_t slots, int64_t base,
+                             int gap_ms) {
+  std::mt19937_64 rng(7);
+  std::vector<double> price(slots, 100.0);
+  std::vector<Tick> ticks;
+  ticks.reserve(n);
+  int64_t ts = base;
+  for (size_t i = 0; i < n; ++i) {
+    uint16_t slot = static_cast<uint16_t>(rng() % slots);
+    price[slot] += (static_cast<int>(rng() % 21) - 10) * 0.01;
+    ts += static_cast<int64_t>(rng() % (2 * gap_ms + 1));
+    if (rng() % 50'000 == 0)
+      ts += 7 * 60'000;
+    ticks.push_back({slot, price[slot], ts});
+  }
+  return ticks;
+}
+
+/// (window start, slot) → bar, computed directly for one horizon.
+using Reference = std::map<std::pair<int64_t, uint16_t>, OHLCBar>;
+
+Reference reference_bars(const std::vector<Tick> &ticks, int64_t interval) {
+  Reference ref;
+  for (const Tick &t : ticks)
+    ref[{t.ts / interval * interval, t.slot}].update(t.price, t.ts);
+  return ref;
+}
+
+/// Every completed bar on every horizon must equal the one computed
+/// directly from the ticks, and every window with ticks must show up.
+void check_against_reference(const std::vector<Tick> &ticks, uint16_t slots,
+                             bool intraday) {
+  MultiHorizonBarAggregator agg(slots);
+  std::vector<Reference> refs;
+  for (size_t h = 0; h < agg.horizons(); ++h)
+    refs.push_back(reference_bars(ticks, agg.interval_ms(h)));
+  std::vector<size_t> seen(agg.horizons(), 0);
+
+  auto collect = [&] {
+    for (size_t h = 0; h < agg.horizons(); ++h) {
+      if (!agg.has_completed_bars(h))
+        continue;
+      std::span<const OHLCBar> bars = agg.consume_completed_bars(h);
+      for (size_t slot = 0; slot < bars.size(); ++slot) {
+        const OHLCBar &bar = bars[slot];
+        if (!bar.count)
+          continue;
+        ++seen[h];
+        auto it = refs[h].find({bar.start_time_ms, static_cast<uint16_t>(slot)});
+        if (it == refs[h].end() || it->second.open != bar.open ||
+            it->second.high != bar.high || it->second.low != bar.low ||
+            it->second.close != bar.close || it->second.count != bar.count ||
+            bar.end_time_ms != bar.start_time_ms + agg.interval_ms(h)) {
+          check(false, "rolled-up bar matches the direct computation");
+          return;
+        }
+      }
+      agg.clear_completed(h);
+    }
+  };
+
+  if (intraday)
+    agg.set_day(ticks.front().ts);
+  for (const Tick &t : ticks) {
+    bool rolled =
+        intraday ? agg.update_intraday(
+                       t.slot, t.price,
+                       static_cast<int32_t>(t.ts % kMsPerDay))
+                 : agg.update(t.slot, t.price, t.ts);
+    if (rolled)
+      collect();
+  }
+  // Close every horizon with a tick one hour past the end
+  agg.update(0, 1.0, (ticks.back().ts / 3'600'000 + 2) * 3'600'000);
+  collect();
+
+  for (size_t h = 0; h < agg.horizons(); ++h)
+    check(seen[h] == refs[h].size(), "every window with ticks completed");
+}
+
+void check_horizon_validation() {
+  auto rejects = [](std::vector<int64_t> horizons) {
+    try {
+      MultiHorizonBarAggregator agg(4, std::move(horizons));
+    } catch (const std::invalid_argument &) {
+      return true;
+    }
+    return false;
+  };
+  check(rejects({}), "no horizons rejected");
+  check(rejects({1'000, 1'500}), "non-multiple rejected");
+  check(rejects({60'000, 1'000}), "descending rejected");
+  check(!rejects({250, 1'000, 60'000}), "nested horizons accepted");
+}
+
+/// Per-tick cost of one SlotBarAggregator per horizon vs the hierarchy.
+void benchmark(uint16_t slots) {
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  // SlotBarAggregator opens its first window at the wall clock
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+  std::vector<Tick> ticks = make_ticks(5'000'000, slots, now, 2);
+  const std::vector<int64_t> horizons = {1'000, 60'000, 300'000, 3'600'000};
+
+  volatile uint64_t sink = 0;
+  std::vector<SlotBarAggregator> separate;
+  for (int64_t interval : horizons)
+    separate.emplace_back(slots, interval);
+  auto start = clock::now();
+  for (const Tick &t : ticks) {
+    for (SlotBarAggregator &agg : separate) {
+      if (agg.update(t.slot, t.price, t.ts)) {
+        sink = sink + agg.consume_completed_bars().size();
+        agg.clear_completed();
+      }
+    }
+  }
+  auto mid = clock::now();
+  MultiHorizonBarAggregator hier(slots, horizons);
+  for (const Tick &t : ticks) {
+    if (hier.update(t.slot, t.price, t.ts)) {
+      for (size_t h = 0; h < hier.horizons(); ++h) {
+        sink = sink + hier.consume_completed_bars(h).size();
+        hier.clear_completed(h);
+      }
+    }
+  }
+  auto end = clock::now();
+
+  double n = static_cast<double>(ticks.size());
+  std::cout << "4 x SlotBarAggregator:     "
+            << duration_cast<nanoseconds>(mid - start).count() / n
+            << " ns/tick\n"
+            << "MultiHorizonBarAggregator: "
+            << duration_cast<nanoseconds>(end - mid).count() / n
+            << " ns/tick\n";
+}
+
+int main() {
+  constexpr uint16_t slots = 64;
+  // Event times from a past recording: windows must not depend on now()
+  const int64_t recorded = 1'749'978'024'759; // first "E" in sample.json
+  std::vector<Tick> ticks = make_ticks(400'000, slots, recorded, 20);
+  check_against_reference(ticks, slots, false);
+  check_against_reference(ticks, slots, true);
+  // Across UTC midnight through the intraday path
+  const int64_t before_midnight = 1'750'032'000'000 - 1'800'000;
+  check_against_reference(make_ticks(200'000, slots, before_midnight, 20),
+                          slots, true);
+  check_horizon_validation();
+  benchmark(400);
+
+  std::cout << (failures ? "multi-horizon bar checks FAILED\n"
+                         : "multi-horizon bar checks passed\n");
+  return failures ? 1 : 0;
+}
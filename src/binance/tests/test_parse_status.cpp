@@ -0,0 +1,93 @@
+#include "book_ticker.hpp"
+#include "book_ticker_parser.hpp"
+#include "book_ticker_scanner.hpp"
+#include "parse_status.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+void check_status(ParserKind kind, const SymbolLookup &lookup) {
+  simdjson::ondemand::parser parser;
+  BookTicker bt;
+  auto status = [&](const std::string &s) {
+    return parse_book_ticker_ec(kind, parser, s, bt, false, &lookup);
+  };
+
+  const std::string good =
+      R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"105131.90","B":"3.188","a":"105132.00","A":"12.773","T":1749978024759,"E":1749978024759})";
+  check(status(good) == ParseStatus::Ok, "good frame");
+  check(bt.id == 290 && bt.update_id == 1 && bt.bid_price == 105131.90,
+        "good frame fields");
+  check(bt.slot == 3, "dense slot (4th lowest ID)");
+
+  check(status(R"({"result":null,"id":1})") == ParseStatus::ControlFrame,
+        "subscription ack");
+  check(status(R"({"error":{"code":2,"msg":"x"},"id":1})") ==
+            ParseStatus::ControlFrame,
+        "error reply");
+  check(status("not json") == ParseStatus::MalformedJson, "not json");
+  check(status("[1,2,3]") == ParseStatus::MalformedJson, "not an object");
+  check(status(R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"1.0"})") ==
+            ParseStatus::MissingField,
+        "missing fields");
+  check(
+      status(
+          R"({"e":"bookTicker","u":1,"s":"BTCUSDT","b":"1.x","B":"1","a":"2","A":"1","T":1,"E":1})") ==
+          ParseStatus::MalformedNumber,
+      "bad price");
+  check(
+      status(
+          R"({"e":"bookTicker","u":1,"s":"NOPEUSDT","b":"1","B":"1","a":"2","A":"1","T":1,"E":1})") ==
+          ParseStatus::UnknownSymbol,
+      "unknown symbol");
+}
+
+void time_sample(const std::vector<std::string> &lines,
+                 const SymbolLookup &lookup) {
+  simdjson::ondemand::parser parser;
+  BookTicker bt;
+  ParseCounters counters;
+  auto start = std::chrono::high_resolution_clock::now();
+  for (const auto &l : lines) {
+    counters.add(parse_book_ticker_ec(ParserKind::Simdjson, parser, l, bt,
+                                      false, &lookup));
+  }
+  auto end = std::chrono::high_resolution_clock::now();
+  auto duration_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+  std::cout << "[ec] Avg per message: " << duration_ns / lines.size()
+            << " ns\n";
+  counters.print(std::cout);
+}
+
+int main(int argc, char **argv) {
+  // "fut" subscription from config/stream_config.json
+  SymbolIdMap map{{"ADAUSDT", 50},    {"AVAXUSDT", 170},  {"BNBUSDT", 258},
+                  {"BTCUSDT", 290},   {"DOGEUSDT", 388},  {"ETHFIUSDT", 469},
+                  {"ETHUSDT", 476},   {"HYPERUSDT", 604}, {"LINKUSDT", 721},
+                  {"SHIBUSDT", 1101}, {"SOLUSDT", 1132},  {"SOLVUSDT", 1136},
+                  {"SUIUSDT", 1178},  {"TRXUSDT", 1258},  {"USDCUSDT", 1288},
+                  {"WBTCUSDT", 1341}, {"XLMUSDT", 1380},  {"XRPUSDT", 1394}};
+  SymbolLookup lookup = make_symbol_lookup(map);
+
+  SymbolSlotMap slots = assign_symbol_slots(map);
+  std::vector<int32_t> slot_ids(map.size(), -1);
+  for (const auto &[symbol, ref] : slots) {
+    if (ref.slot < slot_ids.size())
+      slot_ids[ref.slot] = ref.id;
+  }
+  check(symbol_slot_count(slots) == map.size() &&
+            std::ranges::is_sorted(slot_ids) && slot_ids.front() == 50,
+        "slots are dense and in ID order");
+
+  check_status(ParserKind::Simdjson, lookup);
+  check_status(ParserKind::Fixed, lookup);
+  std::cout << (failures ? "status checks FAILED\n" : "status checks passed\n");
+
+  if (argc > 1)
+    time_sample(get_data(argv[1]), lookup);
+  return failures ? 1 : 0;
+}
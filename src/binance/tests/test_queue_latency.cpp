@@ -0,0 +1,95 @@
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "book_ticker_scanner.hpp"
+#include "common/tsc_clock.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+void spin_for_ns(int64_t ns) {
+  int64_t until = receive_time_ns() + ns;
+  while (receive_time_ns() < until) {
+  }
+}
+
+/**
+ * @brief Replays @p frames @p reps times through @p Queue: the producer parses
+ * each frame (stamping my_receive_time_ns) and enqueues it, the consumer
+ * records now - my_receive_time_ns on dequeue.
+ *
+ * @param gap_ns Pause between frames; 0 measures saturated throughput.
+ */
+template <typename Queue>
+void replay(const char *label, const std::vector<std::string> &frames,
+            int reps, int64_t gap_ns) {
+  auto queue = std::make_unique<Queue>();
+  std::vector<int64_t> latencies;
+  latencies.reserve(frames.size() * reps);
+  std::atomic<bool> done{false};
+
+  std::thread consumer([&] {
+    BookTicker bt;
+    for (;;) {
+      if (queue->try_dequeue(bt)) {
+        latencies.push_back(receive_time_ns() - bt.my_receive_time_ns);
+      } else if (done.load(std::memory_order_acquire)) {
+        if (!queue->try_dequeue(bt))
+          break;
+        latencies.push_back(receive_time_ns() - bt.my_receive_time_ns);
+      }
+    }
+  });
+
+  simdjson::ondemand::parser parser;
+  BookTicker bt{};
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < reps; ++r) {
+    for (const auto &frame : frames) {
+      if (parse_book_ticker_ec(ParserKind::Fixed, parser, frame, bt, true,
+                               nullptr) != ParseStatus::Ok)
+        continue;
+      while (!queue->try_enqueue(bt)) {
+      }
+      if (gap_ns)
+        spin_for_ns(gap_ns);
+    }
+  }
+  done.store(true, std::memory_order_release);
+  consumer.join();
+  auto end = std::chrono::steady_clock::now();
+
+  std::sort(latencies.begin(), latencies.end());
+  auto pct = [&](double p) {
+    return latencies.empty()
+               ? 0
+               : latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+  };
+  double secs = std::chrono::duration<double>(end - start).count();
+  std::cout << label << (gap_ns ? " paced " : " burst ") << latencies.size()
+            << " msgs, " << static_cast<int64_t>(latencies.size() / secs)
+            << " msg/s, latency ns p50=" << pct(0.5) << " p99=" << pct(0.99)
+            << " p99.9=" << pct(0.999) << " max=" << pct(1.0) << "\n";
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <sample.json> [reps]\n";
+    return 1;
+  }
+  auto frames = get_data(argv[1]);
+  int reps = argc > 2 ? std::stoi(argv[2]) : 200;
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+
+  replay<BookTickerQueue>("moodycamel", frames, reps, 0);
+  replay<SpscBookTickerQueue>("spsc      ", frames, reps, 0);
+  replay<BookTickerQueue>("moodycamel", frames, reps / 10 + 1, 1'000);
+  replay<SpscBookTickerQueue>("spsc      ", frames, reps / 10 + 1, 1'000);
+  return 0;
+}
@@ -0,0 +1,218 @@
+#include "bars/quote_bar_aggregator.hpp"
+#include "bars/slot_bar_aggregator_impl.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+bool near(double a, double b) {
+  return std::abs(a - b) <= 1e-9 * std::max(1.0, std::abs(a));
+}
+
+struct Quote {
+  double bid_price;
+  double bid_qty;
+  double ask_price;
+  double ask_qty;
+};
+
+struct Tick {
+  uint16_t slot;
+  Quote quote;
+  int64_t ts;
+};
+
+// Unused statistics cost nothing: a bar is only as big as its fields
+static_assert(sizeof(QuoteBar<>) == 3 * sizeof(int64_t));
+static_assert(sizeof(QuoteBar<TwMid>) < sizeof(QuoteBar<TwMid, TwSpread>));
+static_assert(sizeof(QuoteBar<MicroOHLC>) < sizeof(FullQuoteBar));
+
+/// Hand-computed window with a carried quote.
+void check_time_weighting() {
+  QuoteBarAggregator<FullQuoteBar> agg(2, 1'000);
+  agg.update(0, Quote{100, 1, 102, 3}, 10'100); // mid 101, spread 2
+  agg.update(0, Quote{104, 2, 105, 2}, 10'600); // mid 104.5, spread 1
+  check(!agg.has_completed_bars(), "no bars before the first rollover");
+  check(agg.update(1, Quote{10, 1, 11, 1}, 11'500), "rollover");
+
+  std::span<const FullQuoteBar> bars = agg.consume_completed_bars();
+  const FullQuoteBar &bar = bars[0];
+  check(bar.count == 2 && bar.start_time_ms == 10'000 &&
+            bar.end_time_ms == 11'000,
+        "window bounds and count");
+  // 101 held 500 ms, 104.5 held 400 ms up to the window end
+  check(near(bar.twap_mid.average(), (101.0 * 500 + 104.5 * 400) / 900),
+        "time-weighted mid");
+  check(near(bar.tw_spread.average(), (2.0 * 500 + 1.0 * 400) / 900),
+        "time-weighted spread");
+  check(near(bar.avg_bid_qty(), 1.5) && near(bar.avg_ask_qty(), 2.5),
+        "average top-of-book size");
+  // micro = (bid_qty * ask + ask_qty * bid) / (bid_qty + ask_qty)
+  check(near(bar.micro_open, (1 * 102.0 + 3 * 100.0) / 4) &&
+            near(bar.micro_close, 104.5) && near(bar.micro_high, 104.5) &&
+            near(bar.micro_low, 100.5),
+        "micro-price OHLC");
+  check(bars[1].count == 0 && bars[1].end_time_ms == 0,
+        "slot without quotes stays default");
+  agg.clear_completed();
+
+  // Slot 0 gets no tick in [11000, 12000): its quote is carried
+  check(agg.update(1, Quote{10, 1, 11, 1}, 12'000), "second rollover");
+  const FullQuoteBar &carried = agg.consume_completed_bars()[0];
+  check(carried.count == 0 && near(carried.twap_mid.average(), 104.5) &&
+            carried.twap_mid.weighted_ms == 1'000,
+        "prevailing quote carried over a quiet window");
+}
+
+/// Windows that only carry a quote report the prevailing values, never the
+/// empty-window sentinels or 0/0.
+void check_carried_only() {
+  QuoteBarAggregator<FullQuoteBar> agg(3, 1'000);
+  agg.update(0, Quote{100, 1, 102, 3}, 10'100);
+  agg.update(0, Quote{104, 2, 105, 2}, 10'600); // micro close 104.5
+  agg.update(1, Quote{50, 0, 51, 0}, 10'700);   // no size: no micro-price
+  for (int64_t ts : {11'000, 12'000, 13'000}) {
+    check(agg.update(2, Quote{10, 1, 11, 1}, ts), "rollover");
+    agg.clear_completed();
+  }
+  // Slots 0 and 1 have had no tick since the first window
+  check(agg.update(2, Quote{10, 1, 11, 1}, 14'000), "last rollover");
+  std::span<const FullQuoteBar> bars = agg.consume_completed_bars();
+  const FullQuoteBar &carried = bars[0];
+  check(carried.count == 0 && carried.micro_open == 104.5 &&
+            carried.micro_high == 104.5 && carried.micro_low == 104.5 &&
+            carried.micro_close == 104.5,
+        "carried-only micro OHLC is flat at the previous close");
+  check(carried.avg_bid_qty() == 2 && carried.avg_ask_qty() == 2,
+        "carried-only top sizes are the prevailing ones");
+  check(near(carried.twap_mid.average(), 104.5) &&
+            near(carried.tw_spread.average(), 1.0),
+        "carried-only time-weighted fields");
+
+  const FullQuoteBar &sizeless = bars[1];
+  check(sizeless.count == 0 && std::isnan(sizeless.micro_open) &&
+            std::isnan(sizeless.micro_high) &&
+            std::isnan(sizeless.micro_low) &&
+            std::isnan(sizeless.micro_close),
+        "no micro-price ever seen: micro OHLC is NaN");
+  check(sizeless.avg_bid_qty() == 0 && sizeless.avg_ask_qty() == 0,
+        "prevailing zero sizes");
+}
+
+/// Random quotes; the time-weighted mid of every completed window must equal
+/// a per-millisecond sum of the prevailing mid.
+void check_against_per_ms_sum() {
+  constexpr uint16_t slots = 8;
+  constexpr int64_t interval = 1'000, base = 1'749'978'000'000;
+  std::mt19937_64 rng(3);
+  std::vector<Tick> ticks;
+  int64_t ts = base;
+  for (int i = 0; i < 20'000; ++i) {
+    ts += static_cast<int64_t>(rng() % 4);
+    double bid = 100 + static_cast<double>(rng() % 100) * 0.01;
+    ticks.push_back({static_cast<uint16_t>(rng() % slots),
+                     {bid, 1.0, bid + 0.01 * (1 + rng() % 3), 2.0},
+                     ts});
+  }
+
+  QuoteBarAggregator<QuoteBar<TwMid>> agg(slots, interval);
+  size_t t = 0;
+  std::vector<double> prevailing(slots, NAN);
+  int windows = 0;
+  for (const Tick &tick : ticks) {
+    if (agg.update(tick.slot, tick.quote, tick.ts)) {
+      std::span<const QuoteBar<TwMid>> bars = agg.consume_completed_bars();
+      int64_t start = bars[ticks[t].slot].start_time_ms;
+      std::vector<double> area(slots, 0.0);
+      std::vector<int64_t> held(slots, 0);
+      for (int64_t ms = start; ms < start + interval; ++ms) {
+        while (t < ticks.size() && ticks[t].ts <= ms) {
+          const Quote &q = ticks[t].quote;
+          prevailing[ticks[t].slot] = 0.5 * (q.bid_price + q.ask_price);
+          ++t;
+        }
+        for (uint16_t s = 0; s < slots; ++s) {
+          if (!std::isnan(prevailing[s])) {
+            area[s] += prevailing[s];
+            ++held[s];
+          }
+        }
+      }
+      for (uint16_t s = 0; s < slots; ++s) {
+        if (held[s] && !near(bars[s].twap_mid.average(), area[s] / held[s])) {
+          check(false, "time-weighted mid matches the per-ms sum");
+          return;
+        }
+      }
+      agg.clear_completed();
+      ++windows;
+    }
+  }
+  check(windows > 10, "stream crossed several windows");
+}
+
+/// Per-tick cost of a mid OHLC bar vs one and all quote statistics.
+void benchmark() {
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+  constexpr uint16_t slots = 400;
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+  std::mt19937_64 rng(9);
+  std::vector<Tick> ticks;
+  for (int i = 0; i < 5'000'000; ++i) {
+    double bid = 100 + static_cast<double>(rng() % 100) * 0.01;
+    ticks.push_back({static_cast<uint16_t>(rng() % slots),
+                     {bid, 1.0 + rng() % 5, bid + 0.01, 1.0 + rng() % 7},
+                     now + i / 50});
+  }
+
+  volatile double sink = 0;
+  auto time = [&](const char *name, auto &&one_tick) {
+    auto start = clock::now();
+    for (const Tick &t : ticks)
+      one_tick(t);
+    auto end = clock::now();
+    std::cout << name
+              << duration_cast<nanoseconds>(end - start).count() /
+                     static_cast<double>(ticks.size())
+              << " ns/tick\n";
+  };
+  SlotBarAggregator ohlc(slots, 1'000);
+  time("mid OHLCBar:               ", [&](const Tick &t) {
+    if (ohlc.update(t.slot, MidValue::of(t.quote), t.ts)) {
+      sink = sink + ohlc.consume_completed_bars()[0].close;
+      ohlc.clear_completed();
+    }
+  });
+  QuoteBarAggregator<QuoteBar<TwMid>> tw(slots, 1'000);
+  time("QuoteBar<TwMid>:           ", [&](const Tick &t) {
+    if (tw.update(t.slot, t.quote, t.ts)) {
+      sink = sink + tw.consume_completed_bars()[0].twap_mid.average();
+      tw.clear_completed();
+    }
+  });
+  QuoteBarAggregator<FullQuoteBar> full(slots, 1'000);
+  time("FullQuoteBar:              ", [&](const Tick &t) {
+    if (full.update(t.slot, t.quote, t.ts)) {
+      sink = sink + full.consume_completed_bars()[0].micro_close;
+      full.clear_completed();
+    }
+  });
+}
+
+int main() {
+  check_time_weighting();
+  check_carried_only();
+  check_against_per_ms_sum();
+  benchmark();
+
+  std::cout << (failures ? "quote bar checks FAILED\n"
+                         : "quote bar checks passed\n");
+  return failures ? 1 : 0;
+}
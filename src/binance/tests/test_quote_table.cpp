@@ -0,0 +1,90 @@
+#include "book_ticker.hpp"
+#include "book_ticker_shm.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/tsc_clock.hpp"
+#include "test_util.hpp"
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+/// Every field of a written ticker is derived from update_id, so a torn
+/// snapshot (half old, half new) is detectable by the reader.
+BookTicker make_ticker(int32_t id, int64_t seq) {
+  BookTicker bt{};
+  bt.id = id;
+  bt.update_id = seq;
+  bt.bid_price = static_cast<double>(seq);
+  bt.ask_price = static_cast<double>(seq) + 0.5;
+  bt.bid_qty = static_cast<double>(seq * 2);
+  bt.ask_qty = static_cast<double>(seq * 3);
+  return bt;
+}
+
+bool consistent(const BookTicker &bt, uint64_t key) {
+  const auto seq = static_cast<double>(bt.update_id);
+  return bt.id == static_cast<int32_t>(key) && bt.bid_price == seq &&
+         bt.ask_price == seq + 0.5 && bt.bid_qty == seq * 2 &&
+         bt.ask_qty == seq * 3;
+}
+
+/// One writer hammers @p symbols slots round-robin without pausing while the
+/// main thread snapshots them and records the cost of each read.
+void run(uint64_t symbols, uint64_t reads) {
+  const char *name = "/binance_quotes_test";
+  QuoteTableWriter writer(name, symbols);
+  QuoteTableReader reader(name);
+  check(reader.size() == symbols, "reader sees table size");
+
+  BookTicker bt;
+  check(!reader.read(0, bt), "unwritten slot reads as empty");
+  check(!reader.read(symbols, bt), "out-of-range key rejected");
+
+  std::atomic<bool> stop{false};
+  std::atomic<uint64_t> writes{0};
+  std::thread writer_thread([&] {
+    int64_t seq = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      ++seq;
+      for (uint64_t k = 0; k < symbols; ++k)
+        writer.store(k, make_ticker(static_cast<int32_t>(k), seq));
+      writes.store(static_cast<uint64_t>(seq) * symbols,
+                   std::memory_order_relaxed);
+    }
+  });
+  while (writes.load() == 0)
+    std::this_thread::yield();
+
+  LatencyHistogram latency;
+  uint64_t retries = 0;
+  uint64_t torn = 0;
+  for (uint64_t i = 0; i < reads; ++i) {
+    uint64_t key = i % symbols;
+    int64_t t0 = receive_time_ns();
+    bool ok = reader.read(key, bt, &retries);
+    latency.record(receive_time_ns() - t0);
+    if (!ok || !consistent(bt, key))
+      ++torn;
+    // Let the writer run on a shared core
+    if (i % 4096 == 0)
+      std::this_thread::yield();
+  }
+  stop = true;
+  writer_thread.join();
+
+  check(torn == 0, "every snapshot was consistent");
+  check(reader.version(0) > 0, "version counts writes");
+  std::cout << "symbols=" << symbols << " reads=" << reads
+            << " writes=" << writes.load() << " retries=" << retries
+            << " torn=" << torn << "\n";
+  latency.print(std::cout, "  read latency");
+}
+
+int main() {
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+  run(16, 2'000'000);
+  run(1024, 2'000'000);
+  std::cout << (failures ? "quote table checks FAILED\n"
+                         : "quote table checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+#include "book_ticker.hpp"
+#include "book_ticker_scanner.hpp"
+#include "sharded_book_ticker_queue.hpp"
+#include "stream_config.hpp"
+#include "symbol_id_map.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+std::string lower(std::string s) {
+  for (char &c : s)
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return s;
+}
+
+struct Frame {
+  std::string json;
+  std::string symbol; ///< lowercase, as in StreamConfig::subs
+};
+
+std::vector<Frame> get_frames(const char *fname) {
+  std::vector<Frame> frames;
+  for (std::string &json : get_data(fname)) {
+    size_t s = json.find("\"s\":\"");
+    if (s == std::string::npos)
+      continue;
+    s += 5;
+    std::string symbol = lower(json.substr(s, json.find('"', s) - s));
+    frames.push_back({std::move(json), symbol});
+  }
+  return frames;
+}
+
+/**
+ * @brief Replays @p frames @p reps times through @p shards producer threads,
+ * each parsing only its shard's symbols into its own SPSC ring, and merges
+ * them on the calling thread.
+ *
+ * trade_time is overwritten with the frame's position in the replay, so the
+ * consumer can check that every symbol arrives in order.
+ */
+void run(const std::vector<Frame> &frames, const SymbolIdMap &symbols,
+         int shards, int reps) {
+  StreamConfig cfg;
+  for (const auto &[symbol, id] : symbols)
+    cfg.subs.push_back(lower(symbol));
+  cfg.shards = shards;
+  std::vector<StreamConfig> shard_configs = shard_stream_config(cfg);
+  SymbolLookup lookup = make_symbol_lookup(symbols);
+
+  ShardedBookTickerQueue queue(shard_configs.size());
+  std::atomic<int> producing{static_cast<int>(shard_configs.size())};
+  std::vector<std::thread> producers;
+  for (size_t k = 0; k < shard_configs.size(); ++k) {
+    producers.emplace_back([&, k] {
+      const auto &subs = shard_configs[k].subs;
+      simdjson::ondemand::parser parser;
+      BookTicker bt{};
+      int64_t position = 0;
+      for (int r = 0; r < reps; ++r) {
+        for (const Frame &f : frames) {
+          ++position;
+          if (std::find(subs.begin(), subs.end(), f.symbol) == subs.end())
+            continue;
+          if (parse_book_ticker_ec(ParserKind::Fixed, parser, f.json, bt,
+                                   true, &lookup) != ParseStatus::Ok)
+            continue;
+          bt.trade_time = position;
+          while (!queue.shard(k).try_enqueue(bt))
+            std::this_thread::yield();
+        }
+      }
+      producing.fetch_sub(1, std::memory_order_release);
+    });
+  }
+
+  std::vector<int64_t> last(symbol_id_span(symbols), 0);
+  std::vector<BookTicker> batch(256);
+  bool ordered = true;
+  size_t received = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (;;) {
+    size_t n = queue.try_dequeue_bulk(batch.begin(), batch.size());
+    for (size_t i = 0; i < n; ++i) {
+      if (batch[i].trade_time <= last[batch[i].id])
+        ordered = false;
+      last[batch[i].id] = batch[i].trade_time;
+    }
+    received += n;
+    if (n == 0) {
+      if (producing.load(std::memory_order_acquire) == 0 &&
+          queue.size_approx() == 0)
+        break;
+      std::this_thread::yield();
+    }
+  }
+  double secs = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - start)
+                    .count();
+  for (auto &t : producers)
+    t.join();
+
+  check(ordered, "each symbol arrives in order");
+  std::cout << "shards=" << shard_configs.size() << " received=" << received
+            << " (" << static_cast<int64_t>(received / secs) << " msg/s)\n";
+  queue.print(std::cout);
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <sample.json> <symbols.json> [reps]\n";
+    return 1;
+  }
+  auto frames = get_frames(argv[1]);
+  int reps = argc > 3 ? std::stoi(argv[3]) : 50;
+
+  SymbolIdMap all = load_symbol_map(argv[2]);
+  std::vector<std::string> seen;
+  for (const Frame &f : frames) {
+    if (std::find(seen.begin(), seen.end(), f.symbol) == seen.end())
+      seen.push_back(f.symbol);
+  }
+  SymbolIdMap symbols = filter_symbol_map(all, seen);
+
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+  for (int shards : {1, 2, 4})
+    run(frames, symbols, shards, reps);
+  std::cout << (failures ? "sharding checks FAILED\n"
+                         : "sharding checks passed\n");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,87 @@
+#include "book_ticker.hpp"
+#include "book_ticker_shm.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/tsc_clock.hpp"
+#include "test_util.hpp"
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+struct ReaderResult {
+  uint64_t read = 0;
+  uint64_t lost = 0;
+  bool ordered = true;
+  LatencyHistogram latency;
+};
+
+/// Reads until @p total tickers were read or lost; update_id carries the
+/// sequence number so ordering and loss accounting can be checked.
+void read_all(const char *name, uint64_t total, bool slow, ReaderResult &r,
+              std::atomic<int> &ready) {
+  BookTickerShmReader reader(name);
+  ready.fetch_add(1);
+  BookTicker bt;
+  int64_t last = 0;
+  while (r.read + reader.lost() < total) {
+    ShmReadStatus status = reader.try_read(bt);
+    if (status == ShmReadStatus::Ok) {
+      r.latency.record(receive_time_ns() - bt.my_receive_time_ns);
+      if (bt.update_id <= last)
+        r.ordered = false;
+      last = bt.update_id;
+      ++r.read;
+      if (slow && r.read % 64 == 0)
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+  }
+  r.lost = reader.lost();
+}
+
+void run(uint64_t capacity, uint64_t total) {
+  const char *name = "/binance_bookticker_test";
+  BookTickerShmWriter writer(name, capacity);
+
+  std::atomic<int> ready{0};
+  ReaderResult fast1, fast2, slow;
+  auto start_reader = [&](bool is_slow, ReaderResult &r) {
+    return std::thread(read_all, name, total, is_slow, std::ref(r),
+                       std::ref(ready));
+  };
+  std::thread t1 = start_reader(false, fast1);
+  std::thread t2 = start_reader(false, fast2);
+  std::thread t3 = start_reader(true, slow);
+  while (ready.load() < 3)
+    std::this_thread::yield();
+
+  BookTicker bt{};
+  for (uint64_t i = 1; i <= total; ++i) {
+    bt.update_id = static_cast<int64_t>(i);
+    bt.my_receive_time_ns = receive_time_ns();
+    writer.publish(bt);
+    // Pace the writer so readers with a core of their own keep up
+    if (i % 256 == 0)
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  t1.join();
+  t2.join();
+  t3.join();
+
+  std::cout << "capacity=" << capacity << " published=" << total << "\n";
+  for (auto *r : {&fast1, &fast2, &slow}) {
+    check(r->ordered, "reader saw tickers in order");
+    check(r->read + r->lost == total, "read + lost == published");
+    std::cout << (r == &slow ? "slow reader" : "fast reader") << " read="
+              << r->read << " lost=" << r->lost << "\n";
+    r->latency.print(std::cout, "  fan-out latency");
+  }
+  check(slow.lost > 0, "slow reader was overrun");
+}
+
+int main() {
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+  run(1024, 200'000);
+  std::cout << (failures ? "shm checks FAILED\n" : "shm checks passed\n");
+  return failures ? 1 : 0;
+}
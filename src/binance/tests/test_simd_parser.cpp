@@ -22,14 +22,28 @@ std::vector<std::string> get_data(const char *fname) {
 }
 
 void time_loop(const std::vector<std::string> &data, bool upd_time,
-               SymbolIdMap *symbol_lookup) {
+               const SymbolLookup *symbol_lookup, bool copy_per_msg) {
   auto start = std::chrono::high_resolution_clock::now();
   simdjson::ondemand::parser parser;
   BookTicker bt;
   int N = 0;
   int BAD = 0;
-  for (auto it : data) {
-    bool rv = parse_book_ticker(parser, it, bt, upd_time, symbol_lookup);
+  for (const auto &it : data) {
+    bool rv = false;
+    try {
+      if (copy_per_msg) {
+        // previous behaviour: heap-allocate a padded copy of every message
+        simdjson::padded_string padded(it);
+        rv = parse_book_ticker(parser, padded.data(), padded.size(),
+                               padded.size() + simdjson::SIMDJSON_PADDING, bt,
+                               upd_time, symbol_lookup);
+      } else {
+        rv = parse_book_ticker(parser, std::string_view(it), bt, upd_time,
+                               symbol_lookup);
+      }
+    } catch (const std::exception &) {
+      rv = false;
+    }
     if (rv) {
       ++N;
     } else
@@ -41,26 +55,29 @@ void time_loop(const std::vector<std::string> &data, bool upd_time,
   int T = N + BAD;
   std::cout << "Total=" << duration_ns << ";N=" << N << ";BAD=" << BAD
             << ";Avg=" << (duration_ns / T) << "ns"
-            << ";UPD_ON=" << (upd_time ? "YES" : "NO") << "\n";
+            << ";UPD_ON=" << (upd_time ? "YES" : "NO")
+            << ";INPUT=" << (copy_per_msg ? "PADDED_COPY" : "SCRATCH") << "\n";
 }
 
 void test_parser(const char *fname, const char *cfg_file) {
   auto data = get_data(fname);
-  SymbolIdMap *symbol_lookup = nullptr;
+  SymbolLookup *symbol_lookup = nullptr;
   if (cfg_file) {
     StreamConfigMap cfgmap;
     if (!load_stream_config_file(cfg_file, cfgmap)) {
       return;
     }
     const StreamConfig &stream_config = cfgmap["fut"];
-    SymbolIdMap *symbol_lookup = new SymbolIdMap();
-    *symbol_lookup = json_to_upper_flat_map(stream_config.subs);
+    SymbolLookup *symbol_lookup =
+        new SymbolLookup(make_symbol_lookup(json_to_upper_flat_map(stream_config.subs)));
   }
 
-  time_loop(data, false, symbol_lookup);
-  time_loop(data, false, symbol_lookup);
-  time_loop(data, true, symbol_lookup);
-  time_loop(data, true, symbol_lookup);
+  for (bool copy_per_msg : {true, false}) {
+    time_loop(data, false, symbol_lookup, copy_per_msg);
+    time_loop(data, false, symbol_lookup, copy_per_msg);
+    time_loop(data, true, symbol_lookup, copy_per_msg);
+    time_loop(data, true, symbol_lookup, copy_per_msg);
+  }
 }
 
 int main(int argc, char **argv) {
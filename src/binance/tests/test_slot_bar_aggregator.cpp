@@ -0,0 +1,172 @@
+#include "bars/bar_aggregator_impl.hpp"
+#include "bars/slot_bar_aggregator_impl.hpp"
+#include "common/fixed_point.hpp"
+#include "test_util.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+struct Tick {
+  uint16_t slot;
+  double price;
+  int64_t ts;
+};
+
+/// Random-walk ticks over @p slots symbols starting at the current minute,
+/// about @p per_ms ticks per millisecond.
+std::vector<Tick> make_ticks(size_t n, uint16_t slots, int per_ms) {
+  int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+  std::mt19937_64 rng(42);
+  std::vector<double> price(slots, 100.0);
+  std::vector<Tick> ticks;
+  ticks.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    uint16_t slot = static_cast<uint16_t>(rng() % slots);
+    price[slot] += (static_cast<int>(rng() % 21) - 10) * 0.01;
+    ticks.push_back({slot, price[slot], now + static_cast<int64_t>(i) / per_ms});
+  }
+  return ticks;
+}
+
+bool same_bar(const OHLCBar &a, const OHLCBar &b) {
+  return a.open == b.open && a.high == b.high && a.low == b.low &&
+         a.close == b.close && a.count == b.count &&
+         a.start_time_ms == b.start_time_ms && a.end_time_ms == b.end_time_ms;
+}
+
+/// Feeds the same stream to both aggregators; every completed window must
+/// hold the same bars, and the span must always be one of the two buffers.
+void check_matches_bar_aggregator(const std::vector<Tick> &ticks,
+                                  uint16_t slots) {
+  BarAggregator ref(1'000);
+  SlotBarAggregator agg(slots, 1'000);
+  const OHLCBar *first = nullptr, *second = nullptr;
+  int windows = 0;
+
+  for (const Tick &t : ticks) {
+    bool a = ref.update(t.slot, t.price, t.ts);
+    bool b = agg.update(t.slot, t.price, t.ts);
+    check(a == b, "rollover reported at the same tick");
+    if (!b)
+      continue;
+    check(ref.has_completed_bars() == agg.has_completed_bars(),
+          "has_completed_bars agrees");
+    const auto &expected = ref.consume_completed_bars();
+    std::span<const OHLCBar> bars = agg.consume_completed_bars();
+    if (!first)
+      first = bars.data();
+    else if (!second && bars.data() != first)
+      second = bars.data();
+    check(bars.data() == first || bars.data() == second,
+          "completed span is one of the two preallocated buffers");
+
+    size_t touched = 0;
+    for (size_t slot = 0; slot < bars.size(); ++slot) {
+      if (!bars[slot].count)
+        continue;
+      ++touched;
+      auto it = expected.find(static_cast<int32_t>(slot));
+      if (it == expected.end() || !same_bar(it->second, bars[slot])) {
+        check(false, "completed bar matches BarAggregator");
+        return;
+      }
+    }
+    check(touched == expected.size(), "same symbols completed");
+    ref.clear_completed();
+    agg.clear_completed();
+    check(agg.consume_completed_bars().empty(), "empty after clear");
+    ++windows;
+  }
+  check(windows > 2, "stream crossed several windows");
+
+  check(!agg.update(slots + 5, 1.0, ticks.back().ts), "out-of-range slot");
+}
+
+/// Feeds the stream as 2-decimal integer ticks to FixedSlotBarAggregator and
+/// as the same prices in double to SlotBarAggregator (`--prices fixed` vs
+/// double): every completed bar must convert back to the double one.
+void check_fixed_matches_double(const std::vector<Tick> &ticks,
+                                uint16_t slots) {
+  constexpr int kDecimals = 2;
+  SlotBarAggregator double_bars(slots, 1'000);
+  FixedSlotBarAggregator fixed_bars(slots, 1'000);
+  size_t bars = 0, mismatched = 0;
+
+  for (const Tick &t : ticks) {
+    const int64_t fixed = std::llround(t.price * 100);
+    const double price = fixed_to_double(fixed, kDecimals);
+    double_bars.update(t.slot, price, t.ts);
+    if (!fixed_bars.update(t.slot, fixed, t.ts))
+      continue;
+    std::span<const OHLCBar> d = double_bars.consume_completed_bars();
+    std::span<const FixedOHLCBar> f = fixed_bars.consume_completed_bars();
+    for (size_t slot = 0; slot < d.size() && slot < f.size(); ++slot) {
+      if (!f[slot].count)
+        continue;
+      ++bars;
+      mismatched +=
+          f[slot].count != d[slot].count ||
+          f[slot].start_time_ms != d[slot].start_time_ms ||
+          fixed_to_double(f[slot].open, kDecimals) != d[slot].open ||
+          fixed_to_double(f[slot].high, kDecimals) != d[slot].high ||
+          fixed_to_double(f[slot].low, kDecimals) != d[slot].low ||
+          fixed_to_double(f[slot].close, kDecimals) != d[slot].close;
+    }
+    double_bars.clear_completed();
+    fixed_bars.clear_completed();
+  }
+  std::cout << "[fixed bars] " << bars << " bars, " << mismatched
+            << " mismatched\n";
+  check(bars > 0 && mismatched == 0,
+        "FixedSlotBarAggregator matches SlotBarAggregator");
+}
+
+/// Per-tick cost of both aggregators over the same stream.
+void benchmark(const std::vector<Tick> &ticks, uint16_t slots) {
+  using clock = std::chrono::high_resolution_clock;
+  using std::chrono::duration_cast;
+  using std::chrono::nanoseconds;
+
+  volatile uint64_t sink = 0;
+  BarAggregator ref(1'000);
+  auto start = clock::now();
+  for (const Tick &t : ticks) {
+    if (ref.update(t.slot, t.price, t.ts)) {
+      sink = sink + ref.consume_completed_bars().size();
+      ref.clear_completed();
+    }
+  }
+  auto mid = clock::now();
+  SlotBarAggregator agg(slots, 1'000);
+  for (const Tick &t : ticks) {
+    if (agg.update(t.slot, t.price, t.ts)) {
+      sink = sink + agg.consume_completed_bars().size();
+      agg.clear_completed();
+    }
+  }
+  auto end = clock::now();
+
+  double n = static_cast<double>(ticks.size());
+  std::cout << "BarAggregator:     "
+            << duration_cast<nanoseconds>(mid - start).count() / n
+            << " ns/tick\n"
+            << "SlotBarAggregator: "
+            << duration_cast<nanoseconds>(end - mid).count() / n
+            << " ns/tick\n";
+}
+
+int main() {
+  constexpr uint16_t slots = 400;
+  check_matches_bar_aggregator(make_ticks(200'000, slots, 20), slots);
+  check_fixed_matches_double(make_ticks(200'000, slots, 20), slots);
+  benchmark(make_ticks(5'000'000, slots, 50), slots);
+
+  std::cout << (failures ? "slot bar aggregator checks FAILED\n"
+                         : "slot bar aggregator checks passed\n");
+  return failures ? 1 : 0;
+}
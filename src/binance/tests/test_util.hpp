@@ -0,0 +1,46 @@
+#pragma once
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @file test_util.hpp
+ * @brief Helpers shared by the standalone test programs: a failure counter
+ * with check(), and the reader for recorded frame files such as
+ * test_data/sample.json.
+ */
+
+/// Number of failed check()s; main() returns non-zero when it is set.
+inline int failures = 0;
+
+/// Counts and reports a failed expectation.
+inline void check(bool ok, const char *label) {
+  if (!ok) {
+    std::cerr << "❌ " << label << "\n";
+    ++failures;
+  }
+}
+
+/**
+ * @brief Reads a recorded stream, one frame per line; anything before the
+ * first '{' (e.g. a timestamp prefix) is stripped and lines without JSON are
+ * skipped.
+ */
+inline std::vector<std::string> get_data(const char *fname) {
+  std::vector<std::string> data;
+  std::ifstream strm(fname);
+  if (!strm.is_open()) {
+    std::cerr << "Failed to open " << fname << "\n";
+    return data;
+  }
+  std::string line;
+  while (std::getline(strm, line)) {
+    size_t start = line.find('{');
+    if (start == std::string::npos)
+      continue;
+    data.push_back(line.substr(start));
+  }
+  return data;
+}
@@ -0,0 +1,84 @@
+#include "book_ticker.hpp"
+#include "book_ticker_queue.hpp"
+#include "common/latency_histogram.hpp"
+#include "common/tsc_clock.hpp"
+#include "common/wait_strategy.hpp"
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+/// CPU time consumed by the calling thread, in nanoseconds.
+int64_t thread_cpu_ns() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+/**
+ * @brief Sends @p n tickers spaced @p gap apart (the producer blocks between
+ * messages like the websocket thread does in recv) and records the
+ * enqueue → dequeue latency seen by a consumer using @p kind.
+ */
+void run(WaitKind kind, int n, std::chrono::microseconds gap) {
+  auto queue = std::make_unique<SpscBookTickerQueue>();
+  Doorbell doorbell;
+  std::atomic<bool> done{false};
+  LatencyHistogram hist;
+  int64_t consumer_cpu_ns = 0;
+
+  std::thread consumer([&] {
+    WaitStrategy wait(kind, &doorbell);
+    BookTicker bt;
+    int64_t cpu0 = thread_cpu_ns();
+    while (!done.load(std::memory_order_acquire) || queue->size_approx()) {
+      if (queue->try_dequeue(bt)) {
+        wait.reset();
+        hist.record(receive_time_ns() - bt.my_receive_time_ns);
+      } else {
+        wait.idle([&] { return queue->size_approx() > 0; });
+      }
+    }
+    consumer_cpu_ns = thread_cpu_ns() - cpu0;
+  });
+
+  BookTicker bt{};
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < n; ++i) {
+    std::this_thread::sleep_for(gap);
+    bt.id = i;
+    bt.my_receive_time_ns = receive_time_ns();
+    while (!queue->try_enqueue(bt)) {
+    }
+    doorbell.ring();
+  }
+  done.store(true, std::memory_order_release);
+  doorbell.ring();
+  consumer.join();
+  double wall_ns = std::chrono::duration<double, std::nano>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  std::string label = std::string(to_string(kind)) + " cpu=" +
+                      std::to_string(static_cast<int>(
+                          100.0 * static_cast<double>(consumer_cpu_ns) /
+                          wall_ns)) +
+                      "%";
+  hist.print(std::cout, label.c_str());
+}
+
+int main(int argc, char **argv) {
+  int n = argc > 1 ? std::stoi(argv[1]) : 20'000;
+  auto gap = std::chrono::microseconds(argc > 2 ? std::stoi(argv[2]) : 50);
+  if (select_receive_clock(ClockSource::Tsc))
+    std::cout << "timestamps: tsc\n";
+  std::cout << n << " msgs, " << gap.count() << " us apart\n";
+
+  for (WaitKind kind : {WaitKind::BusySpin, WaitKind::SpinYield,
+                        WaitKind::SpinPark, WaitKind::Sleep})
+    run(kind, n, gap);
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include "book_ticker.hpp"
+#include "book_ticker_batch.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zmq.hpp>
+
+/**
+ * @brief Publishes @p total tickers over PUB/SUB at saturation, @p batch per
+ * frame (1 = the per-ticker message_t path), and reports msg/s as seen by
+ * the subscriber.
+ */
+void run(zmq::context_t &ctx, const std::string &endpoint, size_t batch,
+         size_t total) {
+  zmq::socket_t pub(ctx, zmq::socket_type::pub);
+  pub.set(zmq::sockopt::sndhwm, 0);
+  pub.set(zmq::sockopt::linger, 0);
+  pub.bind(endpoint);
+
+  size_t received = 0;
+  std::chrono::steady_clock::time_point first, last;
+  std::thread sub_thread([&] {
+    zmq::socket_t sub(ctx, zmq::socket_type::sub);
+    sub.set(zmq::sockopt::rcvhwm, 0);
+    sub.set(zmq::sockopt::rcvtimeo, 1000);
+    sub.connect(endpoint);
+    sub.set(zmq::sockopt::subscribe, "");
+    while (received < total) {
+      zmq::message_t msg;
+      if (!sub.recv(msg, zmq::recv_flags::none))
+        break; // timed out
+      if (received == 0)
+        first = std::chrono::steady_clock::now();
+      int64_t n =
+          decode_book_ticker_batch(msg.data(), msg.size(), [](const auto &) {});
+      if (n > 0)
+        received += static_cast<size_t>(n);
+      last = std::chrono::steady_clock::now();
+    }
+  });
+  // Let the subscription propagate (PUB drops until the SUB has joined)
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+  std::vector<BookTicker> tickers(batch);
+  for (size_t i = 0; i < batch; ++i) {
+    tickers[i] = BookTicker{};
+    tickers[i].id = static_cast<int32_t>(i);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (size_t sent = 0; sent < total; sent += batch) {
+    if (batch == 1) {
+      zmq::message_t zmq_msg(sizeof(BookTicker));
+      memcpy(zmq_msg.data(), &tickers[0], sizeof(BookTicker));
+      pub.send(zmq_msg, zmq::send_flags::none);
+    } else {
+      pub.send(encode_book_ticker_batch(tickers.data(), batch),
+               zmq::send_flags::none);
+    }
+  }
+  double send_secs =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  sub_thread.join();
+
+  double recv_secs = std::chrono::duration<double>(last - first).count();
+  std::cout << "batch=" << batch << " sent " << total << " in " << send_secs
+            << " s (" << static_cast<int64_t>(total / send_secs)
+            << " msg/s), received " << received << " ("
+            << static_cast<int64_t>(recv_secs > 0 ? received / recv_secs : 0)
+            << " msg/s)\n";
+}
+
+int main(int argc, char **argv) {
+  std::string endpoint = argc > 1 ? argv[1] : "tcp://127.0.0.1:5599";
+  size_t total = argc > 2 ? std::stoul(argv[2]) : 1'000'000;
+  zmq::context_t ctx(1);
+  for (size_t batch : {1, 8, 32, 128})
+    run(ctx, endpoint, batch, total - total % batch);
+  return 0;
+}
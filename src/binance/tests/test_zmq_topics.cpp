@@ -0,0 +1,109 @@
+#include "book_ticker.hpp"
+#include "book_ticker_topic.hpp"
+#include "test_util.hpp"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zmq.hpp>
+
+struct SubResult {
+  size_t tickers = 0;
+  size_t messages = 0;
+  size_t wrong_symbol = 0;
+  double secs = 0;
+};
+
+/// Receives [topic | payload] messages until @p expected tickers arrived or
+/// the socket times out. @p only_id < 0 subscribes to everything.
+void subscribe(zmq::context_t &ctx, const std::string &endpoint,
+               int32_t only_id, size_t expected, SubResult &r,
+               std::atomic<int> &ready) {
+  zmq::socket_t sub(ctx, zmq::socket_type::sub);
+  sub.set(zmq::sockopt::rcvhwm, 0);
+  sub.set(zmq::sockopt::rcvtimeo, 1000);
+  sub.connect(endpoint);
+  sub.set(zmq::sockopt::subscribe,
+          only_id < 0 ? std::string() : book_ticker_topic(only_id));
+  ready.fetch_add(1);
+
+  std::chrono::steady_clock::time_point first, last;
+  while (r.tickers < expected) {
+    zmq::message_t topic, payload;
+    if (!sub.recv(topic, zmq::recv_flags::none))
+      break; // timed out
+    if (!topic.more() || !sub.recv(payload, zmq::recv_flags::none))
+      break;
+    if (r.messages++ == 0)
+      first = std::chrono::steady_clock::now();
+    int64_t n = decode_book_ticker_batch(
+        payload.data(), payload.size(), [&](const BookTicker &bt) {
+          if (only_id >= 0 && bt.id != only_id)
+            ++r.wrong_symbol;
+        });
+    if (n > 0)
+      r.tickers += static_cast<size_t>(n);
+    last = std::chrono::steady_clock::now();
+  }
+  r.secs = std::chrono::duration<double>(last - first).count();
+}
+
+/**
+ * @brief Publishes @p total tickers spread round-robin over @p symbols IDs,
+ * @p batch per publish call, to one SUB filtered on a single symbol and one
+ * SUB taking everything.
+ */
+void run(zmq::context_t &ctx, const std::string &endpoint, int32_t symbols,
+         size_t batch, size_t total) {
+  zmq::socket_t pub(ctx, zmq::socket_type::pub);
+  pub.set(zmq::sockopt::sndhwm, 0);
+  pub.set(zmq::sockopt::linger, 0);
+  pub.bind(endpoint);
+
+  const int32_t narrow_id = symbols / 2;
+  SubResult narrow, wide;
+  std::atomic<int> ready{0};
+  std::thread t1(subscribe, std::ref(ctx), endpoint, narrow_id,
+                 total / symbols, std::ref(narrow), std::ref(ready));
+  std::thread t2(subscribe, std::ref(ctx), endpoint, -1, total,
+                 std::ref(wide), std::ref(ready));
+  while (ready.load() < 2)
+    std::this_thread::yield();
+  // Let the subscriptions propagate (PUB drops until the SUB has joined)
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+  std::vector<BookTicker> tickers(batch);
+  for (size_t i = 0; i < batch; ++i) {
+    tickers[i] = BookTicker{};
+    tickers[i].id = static_cast<int32_t>(i % symbols);
+  }
+  BookTickerTopicPublisher publisher(pub, batch);
+  for (size_t sent = 0; sent < total; sent += batch)
+    publisher.publish(tickers.data(), batch);
+  t1.join();
+  t2.join();
+
+  std::cout << "symbols=" << symbols << " batch=" << batch << "\n";
+  for (auto *r : {&narrow, &wide}) {
+    std::cout << (r == &narrow ? "  one-symbol SUB" : "  all-symbol SUB")
+              << " tickers=" << r->tickers << " messages=" << r->messages
+              << " ("
+              << static_cast<int64_t>(r->secs > 0 ? r->tickers / r->secs : 0)
+              << " tickers/s)\n";
+  }
+  check(narrow.wrong_symbol == 0, "filtered SUB only saw its symbol");
+  check(narrow.tickers == total / symbols, "filtered SUB got its share");
+  check(wide.tickers == total, "unfiltered SUB got everything");
+}
+
+int main(int argc, char **argv) {
+  std::string endpoint = argc > 1 ? argv[1] : "tcp://127.0.0.1:5598";
+  size_t total = argc > 2 ? std::stoul(argv[2]) : 256'000;
+  zmq::context_t ctx(1);
+  run(ctx, endpoint, 16, 1, total);
+  run(ctx, endpoint, 16, 64, total);
+  std::cout << (failures ? "topic checks FAILED\n" : "topic checks passed\n");
+  return failures ? 1 : 0;
+}
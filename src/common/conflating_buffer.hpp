@@ -0,0 +1,193 @@
+#pragma once
+
+#include "wait_strategy.hpp"
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <type_traits>
+
+/**
+ * @class ConflatingBuffer
+ * @brief Single-producer / single-consumer latest-value-per-key hand-off.
+ *
+ * Instead of queueing every item, the producer overwrites the slot of the
+ * item's key and marks the key in a dirty bitmap; the consumer drains only
+ * dirty keys and always reads the newest value. Memory is one slot per key
+ * no matter how large the burst, and try_enqueue never fails for a key in
+ * range, so a slow consumer sees fewer, fresher items instead of a growing
+ * backlog.
+ *
+ * Exposes the same queue API as SpscRing (try_enqueue, try_dequeue,
+ * try_dequeue_bulk, size_approx) so it can stand in for the FIFO queues.
+ *
+ * - Each slot is a seqlock (odd sequence while the producer copies), so the
+ *   consumer never sees a torn value.
+ * - The consumer clears a key's dirty bit before reading the slot; an update
+ *   racing with the read sets it again, and the consumer skips a value whose
+ *   sequence it has already delivered.
+ *
+ * @tparam T Trivially copyable item with an integral `slot` in [0, keys)
+ * (BookTicker::slot: one dense key per subscribed symbol).
+ */
+template <typename T> class ConflatingBuffer {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "ConflatingBuffer items must be trivially copyable");
+
+public:
+  explicit ConflatingBuffer(size_t keys)
+      : keys_(keys), words_((keys + 63) / 64),
+        slots_(std::make_unique<Slot[]>(keys)),
+        dirty_(std::make_unique<std::atomic<uint64_t>[]>(words_)),
+        delivered_seq_(std::make_unique<uint64_t[]>(keys)) {}
+
+  ConflatingBuffer(const ConflatingBuffer &) = delete;
+  ConflatingBuffer &operator=(const ConflatingBuffer &) = delete;
+
+  /// Producer: overwrites the slot of `item.slot`; false if it is out of
+  /// range.
+  bool try_enqueue(const T &item) {
+    const auto key = static_cast<size_t>(item.slot);
+    if (key >= keys_)
+      return false;
+    Slot &slot = slots_[key];
+    const uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&slot.value, &item, sizeof(T));
+    slot.seq.store(seq + 2, std::memory_order_release);
+    dirty_[key / 64].fetch_or(uint64_t{1} << (key % 64),
+                              std::memory_order_release);
+    producer_.enqueued.store(
+        producer_.enqueued.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+    return true;
+  }
+
+  /// Consumer: pops the latest value of one dirty key; false if none.
+  bool try_dequeue(T &out) { return try_dequeue_bulk(&out, 1) == 1; }
+
+  /**
+   * @brief Consumer: pops the latest value of up to @p max dirty keys.
+   *
+   * Scanning resumes at the key after the last one drained and wraps around,
+   * so a hot key at a low index cannot starve the others.
+   */
+  template <typename It> size_t try_dequeue_bulk(It out, size_t max) {
+    size_t n = 0;
+    if (words_ == 0)
+      return 0;
+    const size_t start = consumer_.next_key < keys_ ? consumer_.next_key : 0;
+    const size_t first = start / 64;
+    const uint64_t from_start = ~uint64_t{0} << (start % 64);
+    // words_ + 1 visits: the start word's keys >= start first, its keys
+    // below start last
+    for (size_t i = 0; i <= words_ && n < max; ++i) {
+      const size_t w = (first + i) % words_;
+      uint64_t bits = dirty_[w].load(std::memory_order_acquire);
+      if (i == 0)
+        bits &= from_start;
+      else if (i == words_)
+        bits &= ~from_start;
+      while (bits && n < max) {
+        const uint64_t bit = bits & (~bits + 1);
+        bits &= bits - 1;
+        dirty_[w].fetch_and(~bit, std::memory_order_acquire);
+        const size_t key =
+            w * 64 + static_cast<size_t>(std::countr_zero(bit));
+        consumer_.next_key = key + 1;
+        if (read_slot(key, *out)) {
+          ++out;
+          ++n;
+        }
+      }
+    }
+    consumer_.delivered.store(
+        consumer_.delivered.load(std::memory_order_relaxed) + n,
+        std::memory_order_relaxed);
+    return n;
+  }
+
+  /// Number of dirty keys (approximate while the producer is running).
+  size_t size_approx() const {
+    size_t n = 0;
+    for (size_t w = 0; w < words_; ++w)
+      n += static_cast<size_t>(
+          std::popcount(dirty_[w].load(std::memory_order_relaxed)));
+    return n;
+  }
+
+  size_t keys() const { return keys_; }
+
+  /// Items accepted by try_enqueue.
+  uint64_t enqueued() const {
+    return producer_.enqueued.load(std::memory_order_relaxed);
+  }
+
+  /// Items handed to the consumer.
+  uint64_t delivered() const {
+    return consumer_.delivered.load(std::memory_order_relaxed);
+  }
+
+  /// Items overwritten before the consumer saw them.
+  uint64_t conflated() const {
+    const uint64_t d = delivered();
+    const uint64_t e = enqueued();
+    return e > d ? e - d : 0;
+  }
+
+  /// Prints the conflation counters on one line.
+  void print(std::ostream &os) const {
+    const uint64_t e = enqueued();
+    os << "conflation: enqueued=" << e << " delivered=" << delivered()
+       << " conflated=" << conflated() << " ratio="
+       << (e ? static_cast<double>(conflated()) / static_cast<double>(e) : 0.0)
+       << '\n';
+  }
+
+private:
+  struct alignas(64) Slot {
+    std::atomic<uint64_t> seq{0}; ///< Even = stable, odd = write in progress
+    T value;
+  };
+
+  struct alignas(64) ProducerSide {
+    std::atomic<uint64_t> enqueued{0};
+  };
+
+  struct alignas(64) ConsumerSide {
+    size_t next_key = 0; ///< Key after the last one drained
+    std::atomic<uint64_t> delivered{0};
+  };
+
+  size_t keys_;
+  size_t words_;
+  std::unique_ptr<Slot[]> slots_;
+  std::unique_ptr<std::atomic<uint64_t>[]> dirty_;
+  std::unique_ptr<uint64_t[]> delivered_seq_; ///< Consumer-owned
+  ProducerSide producer_;
+  ConsumerSide consumer_;
+
+  /// Seqlock read of slot @p key; false if this version was already
+  /// delivered.
+  bool read_slot(size_t key, T &out) {
+    const Slot &slot = slots_[key];
+    for (;;) {
+      const uint64_t s0 = slot.seq.load(std::memory_order_acquire);
+      if (!(s0 & 1)) {
+        std::memcpy(&out, &slot.value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == s0) {
+          if (s0 == delivered_seq_[key])
+            return false;
+          delivered_seq_[key] = s0;
+          return true;
+        }
+      }
+      cpu_relax();
+    }
+  }
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// Largest supported number of decimal places for a fixed-point value.
+inline constexpr int kMaxFixedDecimals = 18;
+
+/// Powers of ten 10^0 .. 10^18 (10^18 is the largest that fits in int64_t).
+inline constexpr std::array<int64_t, kMaxFixedDecimals + 1> kPow10 = [] {
+  std::array<int64_t, kMaxFixedDecimals + 1> p{};
+  p[0] = 1;
+  for (size_t i = 1; i < p.size(); ++i)
+    p[i] = p[i - 1] * 10;
+  return p;
+}();
+
+/**
+ * @brief Parses a plain decimal string (e.g. "105131.90") into an integer
+ * scaled by 10^decimals (e.g. 10513190 for decimals = 2).
+ *
+ * Accepts an optional leading '-', digits and at most one '.'. Parsing stops
+ * at the first other character, which is returned just like from_chars.
+ * Fractional digits beyond @p decimals must be zeros (Binance pads prices to
+ * the symbol precision), otherwise the value is not representable and the
+ * parse fails. Missing fractional digits are filled with zeros.
+ *
+ * This avoids the general float parsing machinery entirely: it is one
+ * multiply-add per digit plus a single final scale.
+ *
+ * @param first Start of the input.
+ * @param last  End of the input.
+ * @param decimals Number of implied decimal places (0..kMaxFixedDecimals).
+ * @param out   Receives the scaled value on success.
+ * @return Pointer one past the last consumed character, or nullptr on error
+ * (no digits, precision loss, or overflow).
+ */
+inline const char *parse_fixed_decimal(const char *first, const char *last,
+                                       int decimals, int64_t &out) {
+  const char *p = first;
+  bool negative = false;
+  if (p != last && *p == '-') {
+    negative = true;
+    ++p;
+  }
+
+  uint64_t value = 0;
+  int digits = 0;
+  for (; p != last && static_cast<unsigned char>(*p - '0') <= 9; ++p) {
+    value = value * 10 + static_cast<uint64_t>(*p - '0');
+    ++digits;
+  }
+
+  int frac = 0;
+  if (p != last && *p == '.') {
+    ++p;
+    for (; p != last && static_cast<unsigned char>(*p - '0') <= 9; ++p) {
+      if (frac < decimals) {
+        value = value * 10 + static_cast<uint64_t>(*p - '0');
+        ++frac;
+        ++digits;
+      } else if (*p != '0') {
+        return nullptr; // more precision than the scale can hold
+      }
+    }
+  }
+
+  if (digits == 0 || digits > kMaxFixedDecimals)
+    return nullptr;
+  if (frac < decimals) {
+    if (digits + (decimals - frac) > kMaxFixedDecimals)
+      return nullptr;
+    value *= static_cast<uint64_t>(kPow10[decimals - frac]);
+  }
+
+  out = negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+  return p;
+}
+
+/// Converts a scaled fixed-point value back to a double.
+inline double fixed_to_double(int64_t value, int decimals) {
+  return static_cast<double>(value) / static_cast<double>(kPow10[decimals]);
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * @class LatencyHistogram
+ * @brief Fixed-size log-linear histogram of nanosecond latencies.
+ *
+ * Each power of two is split into 8 linear sub-buckets (≤12.5% relative
+ * error), covering 0 ns to ~2^63 ns in 496 counters with no allocation, so
+ * record() is cheap enough for the hot path. Single writer; read it from the
+ * same thread or after the writer has stopped.
+ */
+class LatencyHistogram {
+public:
+  static constexpr int kSubBits = 3;
+  static constexpr int kSub = 1 << kSubBits;
+  static constexpr int kBuckets = (64 - kSubBits + 1) * kSub;
+
+  void record(int64_t ns) {
+    uint64_t v = ns > 0 ? static_cast<uint64_t>(ns) : 0;
+    ++counts_[index(v)];
+    ++total_;
+    if (v > max_)
+      max_ = v;
+  }
+
+  uint64_t count() const { return total_; }
+  uint64_t max() const { return max_; }
+
+  /// Upper bound of the bucket holding the @p p quantile (0 < p ≤ 1).
+  uint64_t percentile(double p) const {
+    if (total_ == 0)
+      return 0;
+    uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(total_));
+    if (rank == 0)
+      rank = 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      seen += counts_[i];
+      if (seen >= rank)
+        return std::min(upper_bound(i), max_);
+    }
+    return max_;
+  }
+
+  void reset() { *this = LatencyHistogram{}; }
+
+  /// Writes `label n=<count> p50=… p90=… p99=… p99.9=… max=…` (ns).
+  void print(std::ostream &os, const char *label) const {
+    os << label << " n=" << total_ << " p50=" << percentile(0.5)
+       << " p90=" << percentile(0.9) << " p99=" << percentile(0.99)
+       << " p99.9=" << percentile(0.999) << " max=" << max_ << " ns\n";
+  }
+
+private:
+  std::array<uint64_t, kBuckets> counts_{};
+  uint64_t total_ = 0;
+  uint64_t max_ = 0;
+
+  static int index(uint64_t v) {
+    if (v < kSub)
+      return static_cast<int>(v);
+    int exp = std::bit_width(v) - 1; // >= kSubBits
+    int sub = static_cast<int>((v >> (exp - kSubBits)) & (kSub - 1));
+    return (exp - kSubBits + 1) * kSub + sub;
+  }
+
+  static uint64_t upper_bound(int i) {
+    if (i < kSub)
+      return static_cast<uint64_t>(i);
+    int exp = i / kSub + kSubBits - 1;
+    uint64_t sub = static_cast<uint64_t>(i % kSub);
+    return ((kSub + sub + 1) << (exp - kSubBits)) - 1;
+  }
+};
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @class RcuCell
+ * @brief Read-mostly value swapped by a writer without ever blocking readers
+ * (quiescent-state-based RCU).
+ *
+ * Readers (e.g. websocket parse threads) call read() for the current
+ * snapshot — one acquire load — and quiescent(reader) once they hold no
+ * reference to it any more, typically after each frame. The writer builds a
+ * new value off to the side and publish()es it with a single pointer
+ * exchange; the old value is retired and deleted only once every registered
+ * reader has passed a quiescent point after the swap.
+ *
+ * A reader that never reports (an idle connection) only delays reclamation;
+ * it never blocks the writer or the other readers.
+ *
+ * @tparam T Any type; readers only get `const T &`.
+ */
+template <typename T> class RcuCell {
+public:
+  explicit RcuCell(std::unique_ptr<T> initial, size_t max_readers = 16)
+      : current_(initial.release()), readers_(max_readers) {}
+
+  RcuCell(const RcuCell &) = delete;
+  RcuCell &operator=(const RcuCell &) = delete;
+
+  ~RcuCell() {
+    delete current_.load(std::memory_order_relaxed);
+    for (const Retired &r : retired_)
+      delete r.ptr;
+  }
+
+  /// Registers a reader thread; call before it first reads.
+  /// @throws std::runtime_error when all reader slots are taken.
+  size_t add_reader() {
+    std::lock_guard lock(writer_mutex_);
+    if (reader_count_ == readers_.size())
+      throw std::runtime_error("❌ RcuCell: too many readers");
+    readers_[reader_count_].seen.store(epoch_.load(std::memory_order_relaxed),
+                                       std::memory_order_relaxed);
+    return reader_count_++;
+  }
+
+  /// Reader: current snapshot, valid until this reader's next quiescent().
+  const T &read() const { return *current_.load(std::memory_order_acquire); }
+
+  /// Reader: no reference obtained from read() is held any more.
+  void quiescent(size_t reader) {
+    readers_[reader].seen.store(epoch_.load(std::memory_order_acquire),
+                                std::memory_order_release);
+  }
+
+  /// Writer: swaps in @p next and reclaims what no reader can still see.
+  void publish(std::unique_ptr<T> next) {
+    std::lock_guard lock(writer_mutex_);
+    T *old = current_.exchange(next.release(), std::memory_order_acq_rel);
+    uint64_t epoch = epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    retired_.push_back({old, epoch});
+    reclaim_locked();
+  }
+
+  /// Writer: frees retired snapshots every reader has moved past.
+  /// @return the number still waiting for a reader.
+  size_t reclaim() {
+    std::lock_guard lock(writer_mutex_);
+    return reclaim_locked();
+  }
+
+private:
+  struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> seen{0};
+  };
+
+  struct Retired {
+    T *ptr;
+    uint64_t epoch; ///< Epoch readers must reach before it can be freed
+  };
+
+  size_t reclaim_locked() {
+    uint64_t min_seen = UINT64_MAX;
+    for (size_t i = 0; i < reader_count_; ++i)
+      min_seen = std::min(min_seen,
+                          readers_[i].seen.load(std::memory_order_acquire));
+    std::erase_if(retired_, [&](const Retired &r) {
+      if (r.epoch > min_seen)
+        return false;
+      delete r.ptr;
+      return true;
+    });
+    return retired_.size();
+  }
+
+  std::atomic<T *> current_;
+  alignas(64) std::atomic<uint64_t> epoch_{0};
+  std::vector<ReaderSlot> readers_;
+  size_t reader_count_ = 0;
+  std::vector<Retired> retired_;
+  std::mutex writer_mutex_;
+};
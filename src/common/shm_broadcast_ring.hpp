@@ -0,0 +1,215 @@
+#pragma once
+
+#include "shm_region.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Single-writer, multi-reader broadcast ring in shared memory.
+ *
+ * Layout of the region:
+ *
+ *   [ Header (64 B) | write_seq (64 B) | Slot × capacity ]
+ *
+ * Item n (1-based) lives in slot (n - 1) % capacity. Each slot carries a
+ * per-slot sequence word used as a seqlock: the writer stores 2n - 1 before
+ * copying the payload and 2n after, so a reader expecting item n can tell
+ * whether the slot is not yet written (< 2n - 1), being written (2n - 1),
+ * ready (2n) or already reused by a later lap (> 2n, i.e. the reader was
+ * overrun). Readers keep their own cursor in process memory, never write to
+ * the region, and never slow the writer down.
+ */
+namespace shm_ring {
+
+inline constexpr uint64_t kMagic = 0x474E495252484453; // "SDHRRING"
+/// Bumped whenever the header or the slot payload layout changes (2: BookTicker
+/// `int16_t id` + `uint16_t slot`)
+inline constexpr uint32_t kVersion = 2;
+
+struct alignas(64) Header {
+  std::atomic<uint64_t> magic; ///< Stored last by the writer
+  uint32_t version;
+  uint32_t slot_bytes;
+  uint64_t capacity; ///< Number of slots (power of two)
+};
+
+struct alignas(64) WriteCursor {
+  std::atomic<uint64_t> write_seq; ///< Number of items published so far
+};
+
+template <typename T> struct alignas(64) Slot {
+  std::atomic<uint64_t> seq;
+  T value;
+};
+
+template <typename T> inline size_t region_bytes(uint64_t capacity) {
+  return sizeof(Header) + sizeof(WriteCursor) + capacity * sizeof(Slot<T>);
+}
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared-memory ring needs address-free 64-bit atomics");
+
+} // namespace shm_ring
+
+/**
+ * @class ShmBroadcastWriter
+ * @brief Creates the ring and publishes items into it (one writer thread).
+ */
+template <typename T> class ShmBroadcastWriter {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "shared-memory items must be trivially copyable");
+
+public:
+  /**
+   * @param name     shm object name, e.g. "/binance_bookticker".
+   * @param capacity Slots in the ring; must be a power of two. Readers more
+   * than @p capacity items behind are overrun.
+   */
+  ShmBroadcastWriter(const std::string &name, uint64_t capacity)
+      : region_(ShmRegion::create(name,
+                                  shm_ring::region_bytes<T>(capacity))) {
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+      throw std::runtime_error("❌ shm ring capacity must be a power of two");
+    }
+    auto *base = static_cast<char *>(region_.data());
+    auto *header = new (base) shm_ring::Header{};
+    cursor_ = new (base + sizeof(shm_ring::Header)) shm_ring::WriteCursor{};
+    slots_ = reinterpret_cast<shm_ring::Slot<T> *>(
+        base + sizeof(shm_ring::Header) + sizeof(shm_ring::WriteCursor));
+    for (uint64_t i = 0; i < capacity; ++i)
+      new (&slots_[i]) shm_ring::Slot<T>{};
+    mask_ = capacity - 1;
+    header->version = shm_ring::kVersion;
+    header->slot_bytes = sizeof(shm_ring::Slot<T>);
+    header->capacity = capacity;
+    // Magic last: readers treat a region without it as not ready yet
+    header->magic.store(shm_ring::kMagic, std::memory_order_release);
+  }
+
+  /// Publishes @p item to all readers; never blocks.
+  void publish(const T &item) {
+    uint64_t n = next_++;
+    shm_ring::Slot<T> &slot = slots_[(n - 1) & mask_];
+    slot.seq.store(2 * n - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&slot.value, &item, sizeof(T));
+    slot.seq.store(2 * n, std::memory_order_release);
+    cursor_->write_seq.store(n, std::memory_order_release);
+  }
+
+  uint64_t published() const { return next_ - 1; }
+  const std::string &name() const { return region_.name(); }
+
+private:
+  ShmRegion region_;
+  shm_ring::WriteCursor *cursor_ = nullptr;
+  shm_ring::Slot<T> *slots_ = nullptr;
+  uint64_t mask_ = 0;
+  uint64_t next_ = 1;
+};
+
+/// Outcome of ShmBroadcastReader::try_read.
+enum class ShmReadStatus {
+  Ok,     ///< An item was read
+  Empty,  ///< Nothing new yet
+  Overrun ///< The writer lapped this reader; cursor skipped the lost items
+};
+
+/**
+ * @class ShmBroadcastReader
+ * @brief Independent reader over a ring created by ShmBroadcastWriter.
+ *
+ * Any number of readers (threads or processes) can attach; each tracks its
+ * own position and loss count.
+ */
+template <typename T> class ShmBroadcastReader {
+public:
+  /**
+   * @param name       shm object name used by the writer.
+   * @param from_start If true, start at the oldest item still in the ring;
+   * otherwise only items published after attaching are read.
+   * @throws std::runtime_error if the ring does not exist or its layout does
+   * not match T.
+   */
+  explicit ShmBroadcastReader(const std::string &name, bool from_start = false)
+      : region_(ShmRegion::open(name)) {
+    if (region_.size() <
+        sizeof(shm_ring::Header) + sizeof(shm_ring::WriteCursor))
+      throw std::runtime_error("❌ shm ring too small: " + name);
+    auto *base = static_cast<const char *>(region_.data());
+    const auto *header = reinterpret_cast<const shm_ring::Header *>(base);
+    if (header->magic.load(std::memory_order_acquire) != shm_ring::kMagic ||
+        header->version != shm_ring::kVersion ||
+        header->slot_bytes != sizeof(shm_ring::Slot<T>) ||
+        region_.size() < shm_ring::region_bytes<T>(header->capacity)) {
+      throw std::runtime_error("❌ shm ring layout mismatch: " + name);
+    }
+    capacity_ = header->capacity;
+    mask_ = capacity_ - 1;
+    cursor_ = reinterpret_cast<const shm_ring::WriteCursor *>(
+        base + sizeof(shm_ring::Header));
+    slots_ = reinterpret_cast<const shm_ring::Slot<T> *>(
+        base + sizeof(shm_ring::Header) + sizeof(shm_ring::WriteCursor));
+
+    uint64_t written = cursor_->write_seq.load(std::memory_order_acquire);
+    next_ = from_start && written > capacity_ ? written - capacity_ + 1
+            : from_start                      ? 1
+                                              : written + 1;
+  }
+
+  /**
+   * @brief Reads the next item into @p out.
+   *
+   * On ShmReadStatus::Overrun the skipped items are added to lost() and the
+   * cursor jumps to the oldest item still available; call again to read it.
+   */
+  ShmReadStatus try_read(T &out) {
+    const shm_ring::Slot<T> &slot = slots_[(next_ - 1) & mask_];
+    const uint64_t want = 2 * next_;
+    uint64_t s0 = slot.seq.load(std::memory_order_acquire);
+    if (s0 < want)
+      return ShmReadStatus::Empty; // not written yet, or being written
+    if (s0 == want) {
+      std::memcpy(&out, &slot.value, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == want) {
+        ++next_;
+        return ShmReadStatus::Ok;
+      }
+    }
+    // Slot reused by a later lap: skip to the oldest item still present,
+    // leaving some slack so the writer does not immediately lap us again.
+    uint64_t written = cursor_->write_seq.load(std::memory_order_acquire);
+    uint64_t oldest = written > capacity_ ? written - capacity_ + 1 : 1;
+    uint64_t resume = std::min(written, oldest + capacity_ / 8);
+    if (resume > next_) {
+      lost_ += resume - next_;
+      next_ = resume;
+    }
+    return ShmReadStatus::Overrun;
+  }
+
+  /// Items skipped because the writer overran this reader.
+  uint64_t lost() const { return lost_; }
+
+  /// Items published but not yet read by this reader.
+  uint64_t lag() const {
+    return cursor_->write_seq.load(std::memory_order_acquire) + 1 - next_;
+  }
+
+private:
+  ShmRegion region_;
+  const shm_ring::WriteCursor *cursor_ = nullptr;
+  const shm_ring::Slot<T> *slots_ = nullptr;
+  uint64_t capacity_ = 0;
+  uint64_t mask_ = 0;
+  uint64_t next_ = 1;
+  uint64_t lost_ = 0;
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+/**
+ * @class ShmRegion
+ * @brief RAII mapping of a POSIX shared-memory object (/dev/shm/<name>).
+ *
+ * The creator sizes the object and unlinks it on destruction; openers map an
+ * existing object, read-only or read-write. Names follow shm_open rules
+ * (leading '/', no other slashes).
+ */
+class ShmRegion {
+public:
+  ShmRegion() = default;
+
+  /**
+   * @brief Creates and maps a fresh read-write region of @p size bytes,
+   * prefaulted so the hot path takes no page faults.
+   *
+   * A stale object of the same name (e.g. from a crashed writer) is unlinked
+   * first, so readers still mapping it are left on the old object rather than
+   * seeing it resized underneath them.
+   * @throws std::runtime_error on failure.
+   */
+  static ShmRegion create(const std::string &name, size_t size) {
+    ::shm_unlink(name.c_str());
+    int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0)
+      fail("shm_open", name);
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+      close_and_fail(fd, "ftruncate", name);
+    ShmRegion r = map(fd, name, size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE);
+    r.owner_ = true;
+    return r;
+  }
+
+  /**
+   * @brief Maps an existing region with its current size.
+   * @throws std::runtime_error if it does not exist or cannot be mapped.
+   */
+  static ShmRegion open(const std::string &name, bool writable = false) {
+    int fd = ::shm_open(name.c_str(), writable ? O_RDWR : O_RDONLY, 0);
+    if (fd < 0)
+      fail("shm_open", name);
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+      close_and_fail(fd, "fstat", name);
+    return map(fd, name, static_cast<size_t>(st.st_size),
+               writable ? PROT_READ | PROT_WRITE : PROT_READ,
+               MAP_SHARED | MAP_POPULATE);
+  }
+
+  ShmRegion(ShmRegion &&other) noexcept { *this = std::move(other); }
+
+  ShmRegion &operator=(ShmRegion &&other) noexcept {
+    if (this != &other) {
+      reset();
+      name_ = std::move(other.name_);
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      owner_ = std::exchange(other.owner_, false);
+    }
+    return *this;
+  }
+
+  ShmRegion(const ShmRegion &) = delete;
+  ShmRegion &operator=(const ShmRegion &) = delete;
+
+  ~ShmRegion() { reset(); }
+
+  void *data() const { return data_; }
+  size_t size() const { return size_; }
+  const std::string &name() const { return name_; }
+
+private:
+  std::string name_;
+  void *data_ = nullptr;
+  size_t size_ = 0;
+  bool owner_ = false;
+
+  static ShmRegion map(int fd, const std::string &name, size_t size, int prot,
+                       int flags) {
+    void *p = ::mmap(nullptr, size, prot, flags, fd, 0);
+    if (p == MAP_FAILED)
+      close_and_fail(fd, "mmap", name);
+    ::close(fd);
+    ShmRegion r;
+    r.name_ = name;
+    r.data_ = p;
+    r.size_ = size;
+    return r;
+  }
+
+  [[noreturn]] static void fail(const char *what, const std::string &name) {
+    throw std::runtime_error(std::string("❌ ") + what + " " + name + ": " +
+                             std::strerror(errno));
+  }
+
+  [[noreturn]] static void close_and_fail(int fd, const char *what,
+                                         const std::string &name) {
+    int err = errno;
+    ::close(fd);
+    errno = err;
+    fail(what, name);
+  }
+
+  void reset() {
+    if (data_)
+      ::munmap(data_, size_);
+    if (owner_)
+      ::shm_unlink(name_.c_str());
+    data_ = nullptr;
+    size_ = 0;
+    owner_ = false;
+  }
+};
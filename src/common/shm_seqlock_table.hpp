@@ -0,0 +1,163 @@
+#pragma once
+
+#include "shm_region.hpp"
+#include "wait_strategy.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Fixed table of seqlock-protected slots in shared memory, indexed by
+ * a small integer key (e.g. symbol ID), holding the latest value per key.
+ *
+ * Layout of the region:
+ *
+ *   [ Header (64 B) | Slot × size ]
+ *
+ * Each slot is a sequence word followed by the value. The single writer makes
+ * the word odd, copies the value, and makes it even again; readers copy the
+ * value between two reads of the word and retry if it was odd or changed.
+ * Readers never write to the region, so any number of processes can snapshot
+ * any key at any time without slowing the writer.
+ */
+namespace shm_table {
+
+inline constexpr uint64_t kMagic = 0x454C424154514553; // "SEQTABLE"
+/// Bumped whenever the header or the slot payload layout changes (2: BookTicker
+/// `int16_t id` + `uint16_t slot`)
+inline constexpr uint32_t kVersion = 2;
+
+struct alignas(64) Header {
+  std::atomic<uint64_t> magic; ///< Stored last by the writer
+  uint32_t version;
+  uint32_t slot_bytes;
+  uint64_t size; ///< Number of slots
+};
+
+template <typename T> struct alignas(64) Slot {
+  std::atomic<uint64_t> seq; ///< Even = stable, odd = write in progress
+  T value;
+};
+
+template <typename T> inline size_t region_bytes(uint64_t size) {
+  return sizeof(Header) + size * sizeof(Slot<T>);
+}
+
+} // namespace shm_table
+
+/**
+ * @class ShmSeqlockTableWriter
+ * @brief Creates the table and stores the latest value per key (one writer
+ * thread).
+ */
+template <typename T> class ShmSeqlockTableWriter {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "shared-memory items must be trivially copyable");
+
+public:
+  ShmSeqlockTableWriter(const std::string &name, uint64_t size)
+      : region_(ShmRegion::create(name, shm_table::region_bytes<T>(size))),
+        size_(size) {
+    auto *base = static_cast<char *>(region_.data());
+    auto *header = new (base) shm_table::Header{};
+    slots_ = reinterpret_cast<shm_table::Slot<T> *>(
+        base + sizeof(shm_table::Header));
+    for (uint64_t i = 0; i < size; ++i)
+      new (&slots_[i]) shm_table::Slot<T>{};
+    header->version = shm_table::kVersion;
+    header->slot_bytes = sizeof(shm_table::Slot<T>);
+    header->size = size;
+    header->magic.store(shm_table::kMagic, std::memory_order_release);
+  }
+
+  /// Overwrites slot @p key; false if @p key is out of range.
+  bool store(uint64_t key, const T &value) {
+    if (key >= size_)
+      return false;
+    shm_table::Slot<T> &slot = slots_[key];
+    uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&slot.value, &value, sizeof(T));
+    slot.seq.store(seq + 2, std::memory_order_release);
+    return true;
+  }
+
+  uint64_t size() const { return size_; }
+  const std::string &name() const { return region_.name(); }
+
+private:
+  ShmRegion region_;
+  shm_table::Slot<T> *slots_ = nullptr;
+  uint64_t size_ = 0;
+};
+
+/**
+ * @class ShmSeqlockTableReader
+ * @brief Lock-free snapshot reader over a table created by
+ * ShmSeqlockTableWriter.
+ */
+template <typename T> class ShmSeqlockTableReader {
+public:
+  /// @throws std::runtime_error if the table does not exist or its layout
+  /// does not match T.
+  explicit ShmSeqlockTableReader(const std::string &name)
+      : region_(ShmRegion::open(name)) {
+    if (region_.size() < sizeof(shm_table::Header))
+      throw std::runtime_error("❌ shm table too small: " + name);
+    auto *base = static_cast<const char *>(region_.data());
+    const auto *header = reinterpret_cast<const shm_table::Header *>(base);
+    if (header->magic.load(std::memory_order_acquire) != shm_table::kMagic ||
+        header->version != shm_table::kVersion ||
+        header->slot_bytes != sizeof(shm_table::Slot<T>) ||
+        region_.size() < shm_table::region_bytes<T>(header->size)) {
+      throw std::runtime_error("❌ shm table layout mismatch: " + name);
+    }
+    size_ = header->size;
+    slots_ = reinterpret_cast<const shm_table::Slot<T> *>(
+        base + sizeof(shm_table::Header));
+  }
+
+  /**
+   * @brief Copies a consistent snapshot of slot @p key into @p out.
+   * @param retries If set, incremented once per torn read that was retried.
+   * @return false if @p key is out of range or was never written.
+   */
+  bool read(uint64_t key, T &out, uint64_t *retries = nullptr) const {
+    if (key >= size_)
+      return false;
+    const shm_table::Slot<T> &slot = slots_[key];
+    for (;;) {
+      uint64_t s0 = slot.seq.load(std::memory_order_acquire);
+      if (s0 == 0)
+        return false;
+      if (!(s0 & 1)) {
+        std::memcpy(&out, &slot.value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) == s0)
+          return true;
+      }
+      if (retries)
+        ++*retries;
+      cpu_relax();
+    }
+  }
+
+  /// Number of completed writes to slot @p key (cheap change detection).
+  uint64_t version(uint64_t key) const {
+    return key < size_ ? slots_[key].seq.load(std::memory_order_acquire) / 2
+                       : 0;
+  }
+
+  uint64_t size() const { return size_; }
+
+private:
+  ShmRegion region_;
+  const shm_table::Slot<T> *slots_ = nullptr;
+  uint64_t size_ = 0;
+};
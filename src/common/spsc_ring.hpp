@@ -0,0 +1,147 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+/**
+ * @class SpscRing
+ * @brief Bounded single-producer / single-consumer ring buffer.
+ *
+ * Exposes the subset of the moodycamel::ConcurrentQueue API used in this
+ * project (try_enqueue, try_dequeue, try_dequeue_bulk, size_approx) so it can
+ * stand in for it wherever there is exactly one producer thread and one
+ * consumer thread.
+ *
+ * - Head (consumer) and tail (producer) indices live on separate cache lines,
+ *   each next to the owning side's cached copy of the other index, so the
+ *   shared counters are only read when the cached copy says the ring looks
+ *   full/empty.
+ * - The consumer publishes its head once per bulk dequeue, and for single
+ *   dequeues only every `kHeadPublishBatch` items or when the ring runs dry,
+ *   which keeps the producer's cache line from bouncing on every message.
+ *   The producer publishes each enqueue immediately (one message per websocket
+ *   callback, so deferring would only add latency); try_enqueue_bulk
+ *   publishes once per batch.
+ *
+ * @tparam T        Trivially copyable element (e.g. 64-byte BookTicker).
+ * @tparam Capacity Number of slots; must be a power of two.
+ */
+template <typename T, size_t Capacity> class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "SpscRing capacity must be a power of two");
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SpscRing elements must be trivially copyable");
+
+public:
+  static constexpr size_t kCapacity = Capacity;
+  static constexpr size_t kHeadPublishBatch = std::min<size_t>(Capacity / 4, 32);
+
+  SpscRing() = default;
+  SpscRing(const SpscRing &) = delete;
+  SpscRing &operator=(const SpscRing &) = delete;
+
+  /// Producer: copies @p item into the ring; false if it is full.
+  bool try_enqueue(const T &item) {
+    const size_t tail = producer_.tail.load(std::memory_order_relaxed);
+    if (tail - producer_.cached_head == Capacity) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      if (tail - producer_.cached_head == Capacity)
+        return false;
+    }
+    slots_[tail & kMask] = item;
+    producer_.tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Producer: enqueues up to @p count items, publishing the tail once.
+   * @return number of items enqueued (less than @p count if the ring filled).
+   */
+  template <typename It> size_t try_enqueue_bulk(It first, size_t count) {
+    const size_t tail = producer_.tail.load(std::memory_order_relaxed);
+    size_t free = Capacity - (tail - producer_.cached_head);
+    if (free < count) {
+      producer_.cached_head = consumer_.head.load(std::memory_order_acquire);
+      free = Capacity - (tail - producer_.cached_head);
+    }
+    size_t n = std::min(count, free);
+    for (size_t i = 0; i < n; ++i, ++first)
+      slots_[(tail + i) & kMask] = *first;
+    if (n)
+      producer_.tail.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  /// Consumer: pops the oldest item into @p out; false if the ring is empty.
+  bool try_dequeue(T &out) {
+    const size_t head = consumer_.next;
+    if (head == consumer_.cached_tail) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      if (head == consumer_.cached_tail) {
+        publish_head(head);
+        return false;
+      }
+    }
+    out = slots_[head & kMask];
+    consumer_.next = head + 1;
+    if (head + 1 - consumer_.head.load(std::memory_order_relaxed) >=
+        kHeadPublishBatch)
+      publish_head(head + 1);
+    return true;
+  }
+
+  /**
+   * @brief Consumer: pops up to @p max items into @p out, publishing the head
+   * once.
+   * @return number of items dequeued.
+   */
+  template <typename It> size_t try_dequeue_bulk(It out, size_t max) {
+    const size_t head = consumer_.next;
+    size_t avail = consumer_.cached_tail - head;
+    if (avail < max) {
+      consumer_.cached_tail = producer_.tail.load(std::memory_order_acquire);
+      avail = consumer_.cached_tail - head;
+    }
+    size_t n = std::min(max, avail);
+    for (size_t i = 0; i < n; ++i, ++out)
+      *out = slots_[(head + i) & kMask];
+    consumer_.next = head + n;
+    publish_head(head + n);
+    return n;
+  }
+
+  /// Approximate number of queued items (exact when both sides are idle).
+  size_t size_approx() const {
+    return producer_.tail.load(std::memory_order_acquire) -
+           consumer_.head.load(std::memory_order_acquire);
+  }
+
+private:
+  static constexpr size_t kMask = Capacity - 1;
+  static constexpr size_t kLine = 64;
+
+  struct alignas(kLine) Producer {
+    std::atomic<size_t> tail{0}; ///< Next slot to write (published)
+    size_t cached_head = 0;      ///< Producer's last view of consumer head
+  };
+
+  struct alignas(kLine) Consumer {
+    std::atomic<size_t> head{0}; ///< Slots released to the producer
+    size_t next = 0;             ///< Next slot to read (consumer-private)
+    size_t cached_tail = 0;      ///< Consumer's last view of producer tail
+  };
+
+  void publish_head(size_t head) {
+    if (consumer_.head.load(std::memory_order_relaxed) != head)
+      consumer_.head.store(head, std::memory_order_release);
+  }
+
+  Producer producer_;
+  Consumer consumer_;
+  alignas(kLine) std::array<T, Capacity> slots_;
+};
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct ThreadPlacement
+ * @brief Where and how a named pipeline thread should run.
+ */
+struct ThreadPlacement {
+  /// Allowed CPUs; empty leaves the inherited affinity untouched
+  std::vector<int> cpus;
+
+  /// SCHED_FIFO priority (1-99); 0 keeps the default SCHED_OTHER policy
+  int fifo_priority = 0;
+};
+
+/// Thread name ("ws", "consumer", "main", ...) → placement.
+using ThreadPlacementMap = std::map<std::string, ThreadPlacement>;
+
+/**
+ * @brief Parses a CPU list such as "3", "2,4" or "0-3,8".
+ * @return false on a malformed list.
+ */
+inline bool parse_cpu_list(std::string_view s, std::vector<int> &cpus) {
+  cpus.clear();
+  while (!s.empty()) {
+    size_t comma = s.find(',');
+    std::string_view item = s.substr(0, comma);
+    s = comma == std::string_view::npos ? std::string_view{}
+                                        : s.substr(comma + 1);
+    size_t dash = item.find('-');
+    try {
+      int lo = std::stoi(std::string(item.substr(0, dash)));
+      int hi = dash == std::string_view::npos
+                   ? lo
+                   : std::stoi(std::string(item.substr(dash + 1)));
+      if (lo < 0 || hi < lo || hi >= CPU_SETSIZE)
+        return false;
+      for (int c = lo; c <= hi; ++c)
+        cpus.push_back(c);
+    } catch (const std::exception &) {
+      return false;
+    }
+  }
+  return !cpus.empty();
+}
+
+/**
+ * @brief Parses a `--pin` value of the form `name=cpus[:fifo_priority]`,
+ * e.g. `ws=2`, `consumer=3:50` or `main=0-1`, into @p map.
+ * @return false if the value is malformed.
+ */
+inline bool parse_thread_placement(std::string_view spec,
+                                   ThreadPlacementMap &map) {
+  size_t eq = spec.find('=');
+  if (eq == 0 || eq == std::string_view::npos)
+    return false;
+  std::string name(spec.substr(0, eq));
+  std::string_view rest = spec.substr(eq + 1);
+  size_t colon = rest.find(':');
+
+  ThreadPlacement placement;
+  if (!parse_cpu_list(rest.substr(0, colon), placement.cpus))
+    return false;
+  if (colon != std::string_view::npos) {
+    try {
+      placement.fifo_priority = std::stoi(std::string(rest.substr(colon + 1)));
+    } catch (const std::exception &) {
+      return false;
+    }
+    if (placement.fifo_priority < 0 || placement.fifo_priority > 99)
+      return false;
+  }
+  map[name] = std::move(placement);
+  return true;
+}
+
+/**
+ * @brief Loads thread placements from a JSON file.
+ *
+ * Expected input JSON format:
+ * {
+ *   "ws":       { "cpus": "2",   "fifo_priority": 50 },
+ *   "consumer": { "cpus": "3" },
+ *   "main":     { "cpus": "0-1" }
+ * }
+ *
+ * Entries already in @p map (e.g. from `--pin`) are overwritten.
+ *
+ * @throws std::runtime_error if the file cannot be opened or is malformed,
+ * or a `fifo_priority` is outside 0-99 (as for `--pin`).
+ */
+inline void load_thread_placements(const std::string &filename,
+                                   ThreadPlacementMap &map) {
+  std::ifstream in_file(filename);
+  if (!in_file) {
+    throw std::runtime_error("❌ Failed to open file: " + filename);
+  }
+
+  nlohmann::json j;
+  in_file >> j;
+  if (!j.is_object()) {
+    throw std::runtime_error("❌ JSON root must be an object.");
+  }
+
+  for (const auto &[name, value] : j.items()) {
+    ThreadPlacement placement;
+    if (!parse_cpu_list(value.at("cpus").get<std::string>(), placement.cpus)) {
+      throw std::runtime_error("❌ Invalid cpu list for thread: " + name);
+    }
+    placement.fifo_priority = value.value("fifo_priority", 0);
+    if (placement.fifo_priority < 0 || placement.fifo_priority > 99) {
+      throw std::runtime_error(
+          "❌ fifo_priority must be in [0, 99] for thread: " + name);
+    }
+    map[name] = std::move(placement);
+  }
+}
+
+/// Describes the calling thread's actual CPU set and scheduling policy.
+inline std::string describe_current_thread() {
+  std::ostringstream os;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+    os << "cpus=";
+    bool first = true;
+    for (int c = 0; c < CPU_SETSIZE; ++c) {
+      if (CPU_ISSET(c, &set)) {
+        os << (first ? "" : ",") << c;
+        first = false;
+      }
+    }
+  }
+  int policy;
+  sched_param param{};
+  if (pthread_getschedparam(pthread_self(), &policy, &param) == 0) {
+    os << " sched="
+       << (policy == SCHED_FIFO ? "FIFO:" + std::to_string(param.sched_priority)
+                                : std::string("OTHER"));
+  }
+  return os.str();
+}
+
+/**
+ * @brief Applies the placement registered for @p name (if any) to the
+ * calling thread and reports the result.
+ *
+ * Also names the thread (visible in top/perf). Pinning failures and a
+ * refused SCHED_FIFO (EPERM without CAP_SYS_NICE / rtprio limit) are reported
+ * as warnings; the thread keeps running with whatever was applied.
+ *
+ * @return false if any requested setting could not be applied.
+ */
+inline bool apply_thread_placement(const std::string &name,
+                                   const ThreadPlacementMap &map,
+                                   std::ostream &report = std::cerr) {
+  pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+
+  auto it = map.find(name);
+  if (it == map.end())
+    return true;
+  const ThreadPlacement &placement = it->second;
+  bool ok = true;
+
+  if (!placement.cpus.empty()) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c : placement.cpus)
+      CPU_SET(c, &set);
+    if (int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set)) {
+      report << "⚠️ thread " << name
+             << ": failed to set affinity: " << std::strerror(err) << "\n";
+      ok = false;
+    }
+  }
+
+  if (placement.fifo_priority > 0) {
+    sched_param param{};
+    param.sched_priority = placement.fifo_priority;
+    if (int err = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param)) {
+      report << "⚠️ thread " << name
+             << ": SCHED_FIFO not permitted: " << std::strerror(err) << "\n";
+      ok = false;
+    }
+  }
+
+  report << "📌 thread " << name << ": " << describe_current_thread() << "\n";
+  return ok;
+}
@@ -63,3 +63,73 @@ inline int64_t epoch_ns_to_midnight_ns_utc(int64_t epoch_ns) {
   // Convert to nanoseconds
   return duration_cast<nanoseconds>(since_midnight).count();
 }
+
+/// Milliseconds in a UTC day (UTC has no DST; leap seconds are not counted
+/// in Unix time).
+inline constexpr int64_t kMsPerDay = 86'400'000;
+
+/**
+ * @class UtcMidnightCache
+ * @brief Stateful epoch-ms ↔ ms-since-UTC-midnight converter.
+ *
+ * Caches the start of the current UTC day, so converting a timestamp from the
+ * same day is a subtract and an unsigned compare. The day start is recomputed
+ * only when a timestamp falls outside the cached day (day rollover, or the
+ * first call). Results match epoch_ms_to_midnight_ms_utc().
+ */
+class UtcMidnightCache {
+public:
+  constexpr UtcMidnightCache() = default;
+
+  /// Same as epoch_ms_to_midnight_ms_utc(@p epoch_ms).
+  int32_t to_midnight_ms(int64_t epoch_ms) {
+    uint64_t since = static_cast<uint64_t>(epoch_ms - day_start_ms_);
+    if (since >= static_cast<uint64_t>(kMsPerDay)) [[unlikely]] {
+      set_day(epoch_ms);
+      since = static_cast<uint64_t>(epoch_ms - day_start_ms_);
+    }
+    return static_cast<int32_t>(since);
+  }
+
+  /**
+   * @brief Rebuilds epoch ms from a ms-since-midnight value of a stream that
+   * moves forward in time (e.g. BookTicker::event_time_ms_midnight).
+   *
+   * The value is placed on whichever of the cached day, the next or the
+   * previous day is within half a day of the previous value, so a jump from
+   * 23:59:59.9 to 00:00:00.1 rolls forward and a tick from just before
+   * midnight arriving late rolls back. Call set_day() first.
+   */
+  int64_t to_epoch_ms(int32_t midnight_ms) {
+    if (midnight_ms + kMsPerDay / 2 < last_midnight_ms_) [[unlikely]]
+      day_start_ms_ += kMsPerDay;
+    else if (midnight_ms - kMsPerDay / 2 > last_midnight_ms_) [[unlikely]]
+      day_start_ms_ -= kMsPerDay;
+    last_midnight_ms_ = midnight_ms;
+    return day_start_ms_ + midnight_ms;
+  }
+
+  /// Sets the cached day to the UTC day containing @p epoch_ms.
+  void set_day(int64_t epoch_ms) {
+    int64_t day = epoch_ms / kMsPerDay;
+    if (epoch_ms % kMsPerDay < 0)
+      --day;
+    day_start_ms_ = day * kMsPerDay;
+    last_midnight_ms_ = epoch_ms - day_start_ms_;
+  }
+
+  int64_t day_start_ms() const { return day_start_ms_; }
+
+private:
+  int64_t day_start_ms_ = 0;
+  int64_t last_midnight_ms_ = 0;
+};
+
+/**
+ * @brief Per-thread cached form of epoch_ms_to_midnight_ms_utc() used on the
+ * parse path.
+ */
+inline int32_t cached_midnight_ms_utc(int64_t epoch_ms) {
+  thread_local UtcMidnightCache cache;
+  return cache.to_midnight_ms(epoch_ms);
+}
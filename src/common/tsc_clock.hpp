@@ -0,0 +1,266 @@
+#pragma once
+
+#include "time_utils.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define TSC_CLOCK_X86 1
+#endif
+
+/**
+ * @brief Reads the CPU time-stamp counter (0 on non-x86 targets).
+ */
+inline uint64_t read_tsc() {
+#ifdef TSC_CLOCK_X86
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+/**
+ * @brief True if the CPU advertises an invariant TSC (CPUID 0x80000007
+ * EDX bit 8), i.e. one that ticks at a constant rate across P/C-states and is
+ * synchronised between cores.
+ */
+inline bool has_invariant_tsc() {
+#ifdef TSC_CLOCK_X86
+  unsigned eax, ebx, ecx, edx;
+  if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007)
+    return false;
+  __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+  return (edx & (1u << 8)) != 0;
+#else
+  return false;
+#endif
+}
+
+/**
+ * @class TscClock
+ * @brief Epoch-nanosecond clock derived from the invariant TSC.
+ *
+ * calibrate() pairs TSC readings with CLOCK_REALTIME over a short window to
+ * estimate the tick period; now_ns() then costs one rdtsc plus a multiply
+ * instead of a clock_gettime call. A background thread started with
+ * start_resync() periodically re-anchors the conversion to CLOCK_REALTIME
+ * (refining the tick period over the whole run) so NTP adjustments and
+ * frequency error do not accumulate.
+ *
+ * The conversion parameters are published through a sequence lock: readers
+ * never block and retry only if they race a resync.
+ */
+class TscClock {
+public:
+  TscClock() = default;
+  TscClock(const TscClock &) = delete;
+  TscClock &operator=(const TscClock &) = delete;
+
+  ~TscClock() { stop_resync(); }
+
+  /**
+   * @brief Measures the TSC rate against CLOCK_REALTIME.
+   * @param window Calibration window; longer is more precise.
+   * @return false if the CPU has no invariant TSC.
+   */
+  bool calibrate(std::chrono::milliseconds window =
+                     std::chrono::milliseconds(100)) {
+    if (!has_invariant_tsc())
+      return false;
+    Sample a = sample();
+    std::this_thread::sleep_for(window);
+    Sample b = sample();
+    if (b.tsc <= a.tsc)
+      return false;
+    origin_ = a;
+    publish(b, static_cast<double>(b.ns - a.ns) /
+                   static_cast<double>(b.tsc - a.tsc));
+    return true;
+  }
+
+  /// Current time in nanoseconds since the Unix epoch. calibrate() first.
+  int64_t now_ns() const {
+    uint64_t tsc = read_tsc();
+    for (;;) {
+      uint32_t s0 = seq_.load(std::memory_order_acquire);
+      if (s0 & 1)
+        continue;
+      uint64_t base_tsc = base_tsc_.load(std::memory_order_relaxed);
+      int64_t base_ns = base_ns_.load(std::memory_order_relaxed);
+      double ns_per_tick = ns_per_tick_.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_.load(std::memory_order_relaxed) != s0)
+        continue;
+      int64_t dt = static_cast<int64_t>(tsc - base_tsc);
+      return base_ns + static_cast<int64_t>(static_cast<double>(dt) *
+                                            ns_per_tick);
+    }
+  }
+
+  /**
+   * @brief Re-anchors to CLOCK_REALTIME and refines the tick period over the
+   * interval since calibrate().
+   */
+  void resync() {
+    Sample s = sample();
+    int64_t predicted = now_ns_at(s.tsc);
+    last_error_ns_.store(s.ns - predicted, std::memory_order_relaxed);
+    if (s.tsc > origin_.tsc)
+      publish(s, static_cast<double>(s.ns - origin_.ns) /
+                     static_cast<double>(s.tsc - origin_.tsc));
+  }
+
+  /// Starts a background thread calling resync() every @p interval.
+  void start_resync(std::chrono::milliseconds interval =
+                        std::chrono::milliseconds(1000)) {
+    stop_resync();
+    resync_thread_ = std::jthread([this, interval](std::stop_token stop) {
+      std::mutex m;
+      std::condition_variable_any cv;
+      std::unique_lock lock(m);
+      while (!stop.stop_requested()) {
+        cv.wait_for(lock, stop, interval, [] { return false; });
+        if (!stop.stop_requested())
+          resync();
+      }
+    });
+  }
+
+  void stop_resync() {
+    if (resync_thread_.joinable()) {
+      resync_thread_.request_stop();
+      resync_thread_.join();
+    }
+  }
+
+  /// CLOCK_REALTIME minus the extrapolated TSC time at the last resync.
+  int64_t last_error_ns() const {
+    return last_error_ns_.load(std::memory_order_relaxed);
+  }
+
+  double ticks_per_ns() const {
+    return 1.0 / ns_per_tick_.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Sample {
+    uint64_t tsc = 0;
+    int64_t ns = 0;
+  };
+
+  std::atomic<uint32_t> seq_{0};
+  std::atomic<uint64_t> base_tsc_{0};
+  std::atomic<int64_t> base_ns_{0};
+  std::atomic<double> ns_per_tick_{1.0};
+  std::atomic<int64_t> last_error_ns_{0};
+  Sample origin_;
+  std::jthread resync_thread_;
+
+  /// Takes the tightest of a few TSC/CLOCK_REALTIME pairs, attributing the
+  /// realtime reading to the midpoint of the bracketing TSC reads.
+  static Sample sample() {
+    Sample best;
+    uint64_t best_width = UINT64_MAX;
+    for (int i = 0; i < 8; ++i) {
+      timespec ts;
+      uint64_t t0 = read_tsc();
+      clock_gettime(CLOCK_REALTIME, &ts);
+      uint64_t t1 = read_tsc();
+      if (t1 - t0 < best_width) {
+        best_width = t1 - t0;
+        best.tsc = t0 + (t1 - t0) / 2;
+        best.ns = static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+      }
+    }
+    return best;
+  }
+
+  int64_t now_ns_at(uint64_t tsc) const {
+    int64_t dt = static_cast<int64_t>(
+        tsc - base_tsc_.load(std::memory_order_relaxed));
+    return base_ns_.load(std::memory_order_relaxed) +
+           static_cast<int64_t>(static_cast<double>(dt) *
+                                ns_per_tick_.load(std::memory_order_relaxed));
+  }
+
+  /// Single writer (calibrate / the resync thread).
+  void publish(const Sample &base, double ns_per_tick) {
+    uint32_t s = seq_.load(std::memory_order_relaxed);
+    seq_.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    base_tsc_.store(base.tsc, std::memory_order_relaxed);
+    base_ns_.store(base.ns, std::memory_order_relaxed);
+    ns_per_tick_.store(ns_per_tick, std::memory_order_relaxed);
+    seq_.store(s + 2, std::memory_order_release);
+  }
+};
+
+/// Clock used to stamp `BookTicker::my_receive_time_ns`.
+enum class ClockSource {
+  Chrono, ///< std::chrono::system_clock (now_ns_since_epoch)
+  Tsc     ///< Calibrated invariant TSC (TscClock)
+};
+
+/**
+ * @brief Parses a ClockSource from its CLI name ("chrono" or "tsc").
+ * @return false if the name is not recognised.
+ */
+inline bool parse_clock_source(std::string_view name, ClockSource &source) {
+  if (name == "chrono") {
+    source = ClockSource::Chrono;
+  } else if (name == "tsc") {
+    source = ClockSource::Tsc;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+namespace receive_clock_detail {
+inline std::atomic<bool> use_tsc{false};
+
+inline TscClock &tsc_clock() {
+  static TscClock clock;
+  return clock;
+}
+} // namespace receive_clock_detail
+
+/**
+ * @brief Selects the receive-time clock; call once at startup before the
+ * websocket is started.
+ *
+ * ClockSource::Tsc calibrates the TSC and starts its resync thread.
+ *
+ * @return false (and keeps the chrono clock) if the CPU has no invariant TSC.
+ */
+inline bool select_receive_clock(ClockSource source) {
+  using namespace receive_clock_detail;
+  if (source == ClockSource::Tsc) {
+    TscClock &clock = tsc_clock();
+    if (!clock.calibrate())
+      return false;
+    clock.start_resync();
+  }
+  use_tsc.store(source == ClockSource::Tsc, std::memory_order_release);
+  return true;
+}
+
+/**
+ * @brief Receive timestamp in nanoseconds since the Unix epoch, from the
+ * clock chosen with select_receive_clock() (chrono by default).
+ */
+inline int64_t receive_time_ns() {
+  using namespace receive_clock_detail;
+  if (use_tsc.load(std::memory_order_relaxed))
+    return tsc_clock().now_ns();
+  return now_ns_since_epoch();
+}
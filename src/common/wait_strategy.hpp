@@ -0,0 +1,185 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <linux/futex.h>
+#include <string_view>
+#include <sys/syscall.h>
+#include <thread>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+/// Spin-loop hint: `pause` on x86 (frees pipeline resources for the sibling
+/// hyperthread and avoids the memory-order flush on loop exit).
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  _mm_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+/**
+ * @class Doorbell
+ * @brief Futex-backed wake-up signal from a producer to a parked consumer.
+ *
+ * ring() costs a fence and a relaxed load unless the consumer is actually
+ * parked, so producers can call it after every enqueue.
+ */
+class Doorbell {
+public:
+  /// Producer: call after publishing an item.
+  void ring() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_.load(std::memory_order_relaxed)) {
+      seq_.fetch_add(1, std::memory_order_release);
+      syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq_),
+              FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+    }
+  }
+
+  /**
+   * @brief Consumer: sleeps until ring() or @p timeout, unless @p ready()
+   * already holds once the consumer is marked as waiting.
+   */
+  template <typename Ready>
+  void wait(Ready &&ready, std::chrono::nanoseconds timeout) {
+    uint32_t seq = seq_.load(std::memory_order_acquire);
+    waiting_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!ready()) {
+      timespec ts{static_cast<time_t>(timeout.count() / 1'000'000'000),
+                  static_cast<long>(timeout.count() % 1'000'000'000)};
+      syscall(SYS_futex, reinterpret_cast<uint32_t *>(&seq_),
+              FUTEX_WAIT_PRIVATE, seq, &ts, nullptr, 0);
+    }
+    waiting_.store(false, std::memory_order_relaxed);
+  }
+
+private:
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t));
+  alignas(64) std::atomic<uint32_t> seq_{0};
+  std::atomic<bool> waiting_{false};
+};
+
+/// How an idle pipeline stage waits for work.
+enum class WaitKind {
+  BusySpin,  ///< Spin with `pause`; lowest latency, burns a core
+  SpinYield, ///< Spin, then sched_yield between polls
+  SpinPark,  ///< Spin, then park on a futex until the producer rings
+  Sleep      ///< sleep_for between polls (previous behaviour)
+};
+
+/**
+ * @brief Parses a WaitKind from its CLI name ("spin", "yield", "park" or
+ * "sleep").
+ * @return false if the name is not recognised.
+ */
+inline bool parse_wait_kind(std::string_view name, WaitKind &kind) {
+  if (name == "spin") {
+    kind = WaitKind::BusySpin;
+  } else if (name == "yield") {
+    kind = WaitKind::SpinYield;
+  } else if (name == "park") {
+    kind = WaitKind::SpinPark;
+  } else if (name == "sleep") {
+    kind = WaitKind::Sleep;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+inline const char *to_string(WaitKind kind) {
+  switch (kind) {
+  case WaitKind::BusySpin:
+    return "spin";
+  case WaitKind::SpinYield:
+    return "yield";
+  case WaitKind::SpinPark:
+    return "park";
+  case WaitKind::Sleep:
+    return "sleep";
+  }
+  return "unknown";
+}
+
+/**
+ * @class WaitStrategy
+ * @brief Idle policy for a polling loop.
+ *
+ * Usage, per stage:
+ * @code
+ *   if (queue.try_dequeue(msg)) { wait.reset(); ... }
+ *   else wait.idle([&] { return queue.size_approx() > 0; });
+ * @endcode
+ *
+ * The spinning variants poll `spin_iters` times before escalating. Parking
+ * needs the producer to call Doorbell::ring() after each enqueue; it wakes at
+ * least every `park_timeout` so the stage can still notice shutdown or do
+ * periodic work. Without a doorbell SpinPark degrades to Sleep.
+ */
+class WaitStrategy {
+public:
+  struct Config {
+    WaitKind kind = WaitKind::Sleep;
+    uint32_t spin_iters = 2000;
+    std::chrono::microseconds sleep{5};
+    std::chrono::milliseconds park_timeout{100};
+  };
+
+  explicit WaitStrategy(Config cfg, Doorbell *doorbell = nullptr)
+      : cfg_(cfg), doorbell_(doorbell) {}
+
+  explicit WaitStrategy(WaitKind kind, Doorbell *doorbell = nullptr)
+      : WaitStrategy(Config{.kind = kind}, doorbell) {}
+
+  /// Call when the stage found work.
+  void reset() { spins_ = 0; }
+
+  /**
+   * @brief Call when the stage found no work.
+   * @param ready Cheap "is there work now?" check, used before parking.
+   */
+  template <typename Ready> void idle(Ready &&ready) {
+    switch (cfg_.kind) {
+    case WaitKind::BusySpin:
+      cpu_relax();
+      return;
+    case WaitKind::SpinYield:
+      if (spins_ < cfg_.spin_iters) {
+        ++spins_;
+        cpu_relax();
+      } else {
+        std::this_thread::yield();
+      }
+      return;
+    case WaitKind::SpinPark:
+      if (spins_ < cfg_.spin_iters) {
+        ++spins_;
+        cpu_relax();
+      } else if (doorbell_) {
+        doorbell_->wait(ready, cfg_.park_timeout);
+      } else {
+        std::this_thread::sleep_for(cfg_.sleep);
+      }
+      return;
+    case WaitKind::Sleep:
+      std::this_thread::sleep_for(cfg_.sleep);
+      return;
+    }
+  }
+
+  WaitKind kind() const { return cfg_.kind; }
+
+private:
+  Config cfg_;
+  Doorbell *doorbell_;
+  uint32_t spins_ = 0;
+};
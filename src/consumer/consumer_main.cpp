@@ -1,15 +1,29 @@
 #include "binance/book_ticker/book_ticker.hpp"
+#include "binance/book_ticker/book_ticker_batch.hpp"
+#include "binance/book_ticker/book_ticker_shm.hpp"
+#include "binance/book_ticker/book_ticker_topic.hpp"
 #include "binance/book_ticker/symbol_id_map.hpp"
+#include "common/thread_affinity.hpp"
+#include "common/wait_strategy.hpp"
+#include <algorithm>
 #include <cpr/cpr.h> // C++ Requests (https://github.com/libcpr/cpr)
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
 #include <zmq.hpp>
 
 struct Args {
   bool sendweb = false;
   std::string endpoint_url = "http://webserver:8000/status";
   std::string symbol_file = "/workspace/apps/config/binance/symbols.json";
+  ThreadPlacementMap threads;
+  std::string shm; ///< Read from this shm ring instead of ZMQ when set
+  std::string quotes; ///< Snapshot this shm quote table instead when set
+  std::vector<std::string> symbols; ///< ZMQ topic filter; empty = all
 };
 
 Args parse_args(int argc, char **argv) {
@@ -22,11 +36,37 @@ Args parse_args(int argc, char **argv) {
       args.endpoint_url = argv[++i];
     } else if (arg == "--symbol_file" && i + 1 < argc) {
       args.symbol_file = argv[++i];
+    } else if (arg == "--shm") {
+      args.shm = (i + 1 < argc && argv[i + 1][0] == '/')
+                     ? argv[++i]
+                     : kDefaultBookTickerShm;
+    } else if (arg == "--symbols" && i + 1 < argc) {
+      std::string list = argv[++i];
+      for (size_t pos = 0; pos <= list.size();) {
+        size_t comma = std::min(list.find(',', pos), list.size());
+        if (comma > pos)
+          args.symbols.push_back(to_upper(list.substr(pos, comma - pos)));
+        pos = comma + 1;
+      }
+    } else if (arg == "--quotes") {
+      args.quotes = (i + 1 < argc && argv[i + 1][0] == '/')
+                        ? argv[++i]
+                        : kDefaultQuoteTableShm;
+    } else if (arg == "--pin" && i + 1 < argc &&
+               parse_thread_placement(argv[i + 1], args.threads)) {
+      ++i;
+    } else if (arg == "--pin_config" && i + 1 < argc) {
+      try {
+        load_thread_placements(argv[++i], args.threads);
+      } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+        exit(1);
+      }
     }
     else {
       std::cerr << "❌ Unknown or malformed argument: " << arg << "\n";
       std::cerr << "✅ Usage: " << argv[0]
-                << " [--sendweb] [--endpoint http://host:port/status] [--symbol_file /workspace/apps/config/binance/symbol_file.json]\n";
+                << " [--sendweb] [--endpoint http://host:port/status] [--symbol_file /workspace/apps/config/binance/symbol_file.json] [--symbols BTCUSDT,ETHUSDT] [--shm [/name]] [--quotes [/name]] [--pin consumer=cpus[:prio]] [--pin_config <file>]\n";
       exit(1);
     }
   }
@@ -50,32 +90,132 @@ void push_to_web_server(const BookTicker &msg,
   }
 }
 
+void handle_ticker(const BookTicker &msg, ReverseSymbolIdMap &rmap,
+                   const Args &args) {
+  auto symbol = rmap[msg.id];
+  std::cout << "Symbol: " << symbol << "Symbol ID: " << msg.id << " | Bid: " << msg.bid_price
+            << " | Ask: " << msg.ask_price
+            << " | ts_recv: " << msg.my_receive_time_ns << std::endl;
+  if (args.sendweb) {
+    push_to_web_server(msg, args.endpoint_url);
+  }
+}
+
+/**
+ * @brief Reads tickers from binance_main's shared-memory ring (`--shm`)
+ * instead of ZMQ. Overruns (this reader fell more than a ring's worth of
+ * tickers behind) are reported with the number of tickers lost.
+ *
+ * @return 1 if the ring cannot be opened (binance_main not started with
+ * `--shm`, or a different layout version); otherwise runs forever.
+ */
+int run_shm_consumer(Args args) {
+  apply_thread_placement("consumer", args.threads);
+  std::unique_ptr<BookTickerShmReader> shm_reader;
+  try {
+    shm_reader = std::make_unique<BookTickerShmReader>(args.shm);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+  BookTickerShmReader &reader = *shm_reader;
+  std::cout << "🟢 Consumer ready. Reading shm ring " << args.shm << "\n";
+  ReverseSymbolIdMap rmap = make_reverse_symbol_map(args.symbol_file);
+  WaitStrategy wait(WaitKind::SpinYield);
+  BookTicker msg;
+  while (true) {
+    switch (reader.try_read(msg)) {
+    case ShmReadStatus::Ok:
+      wait.reset();
+      handle_ticker(msg, rmap, args);
+      break;
+    case ShmReadStatus::Overrun:
+      std::cerr << "⚠️ shm reader overrun, lost " << reader.lost()
+                << " tickers so far" << std::endl;
+      break;
+    case ShmReadStatus::Empty:
+      wait.idle([] { return false; });
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Polls binance_main's latest-quote table (`--quotes`) once a second
+ * and handles every symbol whose quote changed since the last poll. Suits
+ * consumers that only need the current top of book, not every update.
+ *
+ * @return 1 if the table cannot be opened; otherwise runs forever.
+ */
+int run_quote_consumer(Args args) {
+  apply_thread_placement("consumer", args.threads);
+  std::unique_ptr<QuoteTableReader> quote_table;
+  try {
+    quote_table = std::make_unique<QuoteTableReader>(args.quotes);
+  } catch (const std::exception &e) {
+    std::cerr << e.what() << "\n";
+    return 1;
+  }
+  QuoteTableReader &table = *quote_table;
+  std::cout << "🟢 Consumer ready. Polling quote table " << args.quotes
+            << " (" << table.size() << " slots)\n";
+  ReverseSymbolIdMap rmap = make_reverse_symbol_map(args.symbol_file);
+  std::vector<uint64_t> seen(table.size(), 0);
+  uint64_t retries = 0;
+  BookTicker msg;
+  while (true) {
+    for (const auto &[id, symbol] : rmap) {
+      if (id < 0 || static_cast<uint64_t>(id) >= table.size())
+        continue;
+      uint64_t version = table.version(static_cast<uint64_t>(id));
+      if (version == seen[id] || !table.read(id, msg, &retries))
+        continue;
+      seen[id] = version;
+      handle_ticker(msg, rmap, args);
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+  }
+}
+
 void run_consumer(Args args) {
+  apply_thread_placement("consumer", args.threads);
   zmq::context_t context(1);
   zmq::socket_t socket(context, zmq::socket_type::sub); // 🔁 CHANGE: PULL → SUB
 
   socket.connect("tcp://producer:5555"); // 🔁 CHANGE: bind → connect
 
-  // 🔁 NEW: Subscribe to all messages ("" = no topic filter)
-  socket.set(zmq::sockopt::subscribe, "");
+  // Subscribe to the symbol-ID topic of each --symbols entry, so the
+  // publisher drops other symbols; "" = no topic filter
+  if (args.symbols.empty()) {
+    socket.set(zmq::sockopt::subscribe, "");
+  } else {
+    // The symbol file has lowercase keys; --symbols is uppercased
+    SymbolIdMap symbol_map;
+    for (const auto &[symbol, id] : load_symbol_map(args.symbol_file))
+      symbol_map.emplace(to_upper(symbol), id);
+    for (const std::string &symbol : args.symbols) {
+      auto it = symbol_map.find(symbol);
+      if (it == symbol_map.end()) {
+        std::cerr << "⚠️ Unknown symbol, not subscribed: " << symbol << "\n";
+        continue;
+      }
+      socket.set(zmq::sockopt::subscribe, book_ticker_topic(it->second));
+    }
+  }
 
   std::cout << "🟢 Consumer ready. Subscribed to tcp://producer:5555\n";
   ReverseSymbolIdMap rmap = make_reverse_symbol_map(args.symbol_file);
+  // Accepts single BookTicker frames and batch frames (--zmq_batch)
+  auto handle = [&](const BookTicker &msg) { handle_ticker(msg, rmap, args); };
   while (true) {
     zmq::message_t zmq_msg;
     auto result = socket.recv(zmq_msg, zmq::recv_flags::none);
+    // [topic | payload]: skip the topic frame
+    if (result && zmq_msg.more())
+      result = socket.recv(zmq_msg, zmq::recv_flags::none);
 
-    if (result && *result == sizeof(BookTicker)) {
-      BookTicker msg;
-      memcpy(&msg, zmq_msg.data(), sizeof(BookTicker));
-      auto symbol = rmap[msg.id];
-      std::cout << "Symbol: " << symbol << "Symbol ID: " << msg.id << " | Bid: " << msg.bid_price
-                << " | Ask: " << msg.ask_price
-                << " | ts_recv: " << msg.my_receive_time_ns << std::endl;
-      if (args.sendweb) {
-        push_to_web_server(msg, args.endpoint_url);
-      }
-    } else {
+    if (!result ||
+        decode_book_ticker_batch(zmq_msg.data(), zmq_msg.size(), handle) < 0) {
       std::cerr << "⚠️ Invalid message size: " << zmq_msg.size()
                 << std::endl;
     }
@@ -84,5 +224,9 @@ void run_consumer(Args args) {
 
 int main(int argc, char **argv) {
   Args args = parse_args(argc, argv);
+  if (!args.quotes.empty())
+    return run_quote_consumer(args);
+  if (!args.shm.empty())
+    return run_shm_consumer(args);
   run_consumer(args);
 }
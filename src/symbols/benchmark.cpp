@@ -8,6 +8,7 @@
 #include <nlohmann/json.hpp>
 #include "robin_hood.h"
 #include "symbol_lookup.hpp"  // gperf
+#include "symbol_lookup_table.hpp"  // packed + generated perfect hash
 
 using json = nlohmann::json;
 constexpr int NUM_TRIALS = 1'000'000;
@@ -38,7 +39,7 @@ void benchmark_map(const std::string& label, const Map& map, const std::vector<s
     auto start = std::chrono::high_resolution_clock::now();
     for (int i = 0; i < NUM_TRIALS; ++i) {
         const std::string& sym = symbols[dist(rng)];
-        result ^= map.at(sym);
+        result = result ^ map.at(sym);
     }
     auto end = std::chrono::high_resolution_clock::now();
 
@@ -56,7 +57,7 @@ void benchmark_gperf(const std::vector<std::string>& symbols) {
     for (int i = 0; i < NUM_TRIALS; ++i) {
         const std::string& sym = symbols[dist(rng)];
         const SymbolEntry* entry = ph.lookup_symbol(sym.c_str(), sym.size());
-        if (entry) result ^= entry->id;
+        if (entry) result = result ^ entry->id;
     }
     auto end = std::chrono::high_resolution_clock::now();
 
@@ -65,6 +66,24 @@ void benchmark_gperf(const std::vector<std::string>& symbols) {
               << duration.count() / NUM_TRIALS << " ns\n";
 }
 
+template <typename Lookup>
+void benchmark_lookup(const std::string& label, Lookup lookup, const std::vector<std::string>& symbols) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> dist(0, symbols.size() - 1);
+    volatile int32_t result = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < NUM_TRIALS; ++i) {
+        const std::string& sym = symbols[dist(rng)];
+        result = result ^ lookup(std::string_view(sym));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto duration = std::chrono::duration<double, std::nano>(end - start);
+    std::cout << label << " avg lookup: "
+              << duration.count() / NUM_TRIALS << " ns\n";
+}
+
 int main() {
     symbol_map_std std_map;
     symbol_map_rh rh_map;
@@ -76,6 +95,20 @@ int main() {
     benchmark_map("robin_hood::flat_map", rh_map, symbols);
     benchmark_gperf(symbols);
 
+    // The packed and generated tables are keyed on the uppercase symbols that
+    // appear in bookTicker frames.
+    SymbolIdMap upper_map;
+    std::vector<std::string> upper_symbols;
+    for (const auto& sym : symbols) {
+        upper_symbols.push_back(to_upper(sym));
+        upper_map[upper_symbols.back()] = std_map[sym];
+    }
+    PackedSymbolTable packed(upper_map);
+    benchmark_lookup("packed (SIMD key compare)",
+                     [&](std::string_view s) { return packed.find(s); }, upper_symbols);
+    benchmark_lookup("generated perfect hash",
+                     [](std::string_view s) { return perfect_hash_symbol_id(s); }, upper_symbols);
+
     return 0;
 }
 
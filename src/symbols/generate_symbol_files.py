@@ -1,16 +1,22 @@
 from pathlib import Path
+import argparse
 import json
-import requests
 
 EXCHANGE_INFO_FILE = Path("binance.json")
 GPERF_FILE = Path("symbol_keywords.gperf")
 SYMBOLS_JSON_FILE = Path("symbols.json")
+SYMBOL_SCALES_FILE = Path("symbol_scales.json")
+PERFECT_HASH_FILE = Path("symbol_perfect_hash.hpp")
+
+MASK64 = (1 << 64) - 1
 
 def load_exchange_info():
     if EXCHANGE_INFO_FILE.exists():
         print(f"📄 Loading cached exchange info from {EXCHANGE_INFO_FILE}")
         return json.loads(EXCHANGE_INFO_FILE.read_text())
     else:
+        import requests
+
         print("🌐 Fetching exchange info from Binance API...")
         url = "https://api.binance.com/api/v3/exchangeInfo"
         response = requests.get(url)
@@ -52,9 +58,121 @@ def write_symbols_json(symbols):
     SYMBOLS_JSON_FILE.write_text(json.dumps(symbol_map, indent=2))
     print(f"📦 Wrote {len(symbol_map)} entries to {SYMBOLS_JSON_FILE}")
 
+def step_to_decimals(step):
+    """'0.01000000' -> 2, '1.00000000' -> 0"""
+    frac = step.split(".")[1].rstrip("0") if "." in step else ""
+    return len(frac)
+
+def write_symbol_scales(exchange_info, symbols):
+    """Per-symbol decimals for fixed-point prices (tickSize) and quantities (stepSize)."""
+    wanted = set(symbols)
+    scales = {}
+    for s in exchange_info["symbols"]:
+        symbol = s["symbol"].lower()
+        if symbol not in wanted:
+            continue
+        filters = {f["filterType"]: f for f in s.get("filters", [])}
+        scale = {"price_decimals": 8, "qty_decimals": 8}
+        if "PRICE_FILTER" in filters:
+            scale["price_decimals"] = step_to_decimals(filters["PRICE_FILTER"]["tickSize"])
+        if "LOT_SIZE" in filters:
+            scale["qty_decimals"] = step_to_decimals(filters["LOT_SIZE"]["stepSize"])
+        scales[symbol] = scale
+    SYMBOL_SCALES_FILE.write_text(json.dumps(scales, indent=2))
+    print(f"📐 Wrote {len(scales)} scales to {SYMBOL_SCALES_FILE}")
+
+def pack_symbol(symbol):
+    """Uppercase symbol -> (lo, hi) little-endian words, as pack_symbol() in packed_symbol.hpp."""
+    raw = symbol.upper().encode()
+    if not raw or len(raw) > 16:
+        raise ValueError(f"symbol does not fit in 16 bytes: {symbol}")
+    raw = raw.ljust(16, b"\0")
+    return int.from_bytes(raw[:8], "little"), int.from_bytes(raw[8:], "little")
+
+def packed_hash(lo, hi, seed):
+    """Must match packed_hash() in src/binance/book_ticker/packed_symbol.hpp."""
+    h = ((lo ^ seed) * 0x9E3779B97F4A7C15) & MASK64
+    h ^= (hi + (h >> 29)) & MASK64
+    h = (h * 0xC2B2AE3D27D4EB4F) & MASK64
+    return h ^ (h >> 32)
+
+def fast_range(h, n):
+    return ((h >> 32) * n) >> 32
+
+def build_perfect_hash(symbol_map):
+    """Hash-and-displace: the first hash picks a bucket, each bucket gets the
+    first seed that sends all of its keys to distinct free slots."""
+    keys = {symbol: pack_symbol(symbol) for symbol in symbol_map}
+    num_buckets = max(1, len(keys) // 4)
+    table_size = len(keys) + len(keys) // 4 + 1
+
+    buckets = [[] for _ in range(num_buckets)]
+    for symbol, (lo, hi) in keys.items():
+        buckets[fast_range(packed_hash(lo, hi, 0), num_buckets)].append(symbol)
+
+    seeds = [0] * num_buckets
+    table = [None] * table_size
+    order = sorted(range(num_buckets), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            slots = [fast_range(packed_hash(*keys[s], seed), table_size) for s in buckets[b]]
+            if len(set(slots)) == len(slots) and all(table[x] is None for x in slots):
+                break
+            seed += 1
+        seeds[b] = seed
+        for symbol, slot in zip(buckets[b], slots):
+            table[slot] = symbol
+    return keys, seeds, table
+
+def write_perfect_hash_header(symbol_map, path):
+    keys, seeds, table = build_perfect_hash(symbol_map)
+    print(f"🔑 Writing perfect hash for {len(keys)} symbols ({len(table)} slots) to {path}")
+    lines = [
+        "// Generated by src/symbols/generate_symbol_files.py -- do not edit.",
+        "#pragma once",
+        "",
+        '#include "packed_symbol.hpp"',
+        "#include <cstdint>",
+        "",
+        "namespace symbol_perfect_hash {",
+        "",
+        f"inline constexpr uint32_t kNumSymbols = {len(keys)};",
+        f"inline constexpr uint32_t kNumBuckets = {len(seeds)};",
+        f"inline constexpr uint32_t kTableSize = {len(table)};",
+        "",
+        "inline constexpr uint32_t kSeeds[kNumBuckets] = {",
+    ]
+    for i in range(0, len(seeds), 12):
+        lines.append("    " + ", ".join(str(s) for s in seeds[i:i + 12]) + ",")
+    lines += ["};", "", "inline constexpr PerfectHashEntry kTable[kTableSize] = {"]
+    for symbol in table:
+        if symbol is None:
+            lines.append("    {{0x0ULL, 0x0ULL}, -1},")
+        else:
+            lo, hi = keys[symbol]
+            lines.append(f"    {{{{0x{lo:x}ULL, 0x{hi:x}ULL}}, {symbol_map[symbol]}}}, // {symbol.upper()}")
+    lines += ["};", "", "} // namespace symbol_perfect_hash", ""]
+    Path(path).write_text("\n".join(lines))
+
 if __name__ == "__main__":
-    data = load_exchange_info()
-    symbols = extract_symbols(data)
-    write_gperf_file(symbols)
-    write_symbols_json(symbols)
+    parser = argparse.ArgumentParser(description="Generate Binance symbol lookup files.")
+    parser.add_argument("--symbols-json", type=Path,
+                        help="Reuse an existing symbols.json (keeps its IDs) instead of fetching exchange info")
+    parser.add_argument("--perfect-hash-out", type=Path, default=PERFECT_HASH_FILE,
+                        help="Output path for the generated C++ perfect-hash header")
+    args = parser.parse_args()
+
+    if args.symbols_json:
+        symbol_map = json.loads(args.symbols_json.read_text())
+    else:
+        data = load_exchange_info()
+        symbols = extract_symbols(data)
+        write_gperf_file(symbols)
+        write_symbols_json(symbols)
+        write_symbol_scales(data, symbols)
+        symbol_map = {symbol: i for i, symbol in enumerate(symbols)}
+    write_perfect_hash_header(symbol_map, args.perfect_hash_out)
 